@@ -0,0 +1,27 @@
+<?php
+
+/**
+ * opcache 预加载脚本
+ *
+ * php.ini:
+ *   opcache.enable=1
+ *   opcache.preload=/path/to/vendor/kingbes/raylib/preload.php
+ *   ffi.enable=preload
+ *
+ * 头文件只在服务启动时解析一次，Base::ffi() 通过 FFI::scope() 获取。
+ * 需要缩小解析范围时，在 Base::preload() 之前调用 Base::modules()。
+ */
+
+// 严格模式
+declare(strict_types=1);
+
+require __DIR__ . '/src/Base.php';
+
+\Kingbes\Raylib\Base::preload();
+
+// 编译全部类文件，进程中直接使用缓存的字节码
+foreach (new RecursiveIteratorIterator(new RecursiveDirectoryIterator(__DIR__ . '/src')) as $file) {
+    if ($file->getExtension() === 'php' && $file->getRealPath() !== realpath(__DIR__ . '/src/Base.php')) {
+        opcache_compile_file($file->getRealPath());
+    }
+}
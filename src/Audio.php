@@ -9,12 +9,18 @@ use Kingbes\Raylib\Utils\Sound;
 use Kingbes\Raylib\Utils\Wave;
 use Kingbes\Raylib\Utils\Music;
 use Kingbes\Raylib\Utils\AudioStream;
+use Kingbes\Raylib\Utils\AudioRingBuffer;
+use Kingbes\Raylib\Utils\WaveSamples;
+use Kingbes\Raylib\Utils\SoundPool;
 
 /**
  * Audio类
  */
 class Audio extends Base
 {
+    // 头文件模块
+    protected const MODULE = 'audio';
+
     //### 音频设备管理函数
 
     /**
@@ -86,12 +92,20 @@ class Audio extends Base
      *
      * @param string $fileType 文件类型（例如".wav"）
      * @param string $fileData 文件数据
-     * @param int $dataSize 数据大小
+     * @param int|null $dataSize 数据大小，null 表示整个字符串
      * @return Wave Wave对象
+     * @throws \InvalidArgumentException 如果数据大小超出字符串长度
      */
-    public static function loadWaveFromMemory(string $fileType, string $fileData, int $dataSize): Wave
+    public static function loadWaveFromMemory(string $fileType, string $fileData, ?int $dataSize = null): Wave
     {
-        return new Wave(self::ffi()->LoadWaveFromMemory($fileType, $fileData, $dataSize));
+        $dataSize ??= strlen($fileData);
+        if ($dataSize < 0 || $dataSize > strlen($fileData)) {
+            throw new \InvalidArgumentException("Data size " . $dataSize . " exceeds the " . strlen($fileData) . " bytes given");
+        }
+        // FFI 不会把字符串转换为 const unsigned char *，一次 memcpy 到原生缓冲区；解码在调用期间完成，之后即可释放
+        $buffer = self::ffi()->new('unsigned char[' . max(1, $dataSize) . ']');
+        \FFI::memcpy($buffer, $fileData, $dataSize);
+        return new Wave(self::ffi()->LoadWaveFromMemory($fileType, $buffer, $dataSize));
     }
 
     /**
@@ -138,6 +152,29 @@ class Audio extends Base
         return new Sound(self::ffi()->LoadSoundAlias($source->struct()));
     }
 
+    /**
+     * 加载声音复音池（同一声音的多个别名声部，可以重叠播放）
+     *
+     * @param Sound $source 原声音
+     * @param int $voices 声部数量
+     * @return SoundPool SoundPool对象
+     */
+    public static function loadSoundPool(Sound $source, int $voices = 8): SoundPool
+    {
+        return new SoundPool($source, $voices);
+    }
+
+    /**
+     * 卸载声音复音池（不卸载原声音）
+     *
+     * @param SoundPool $pool SoundPool对象
+     * @return void
+     */
+    public static function unloadSoundPool(SoundPool $pool): void
+    {
+        $pool->unload();
+    }
+
     /**
      * 检查声音有效性
      *
@@ -353,36 +390,32 @@ class Audio extends Base
     }
 
     /**
-     * 加载Wave采样数据（返回32位浮点数组）
+     * 加载Wave采样数据（32位浮点，交错排列）
+     *
+     * 返回直接指向 raylib 分配内存的视图，不复制成 PHP 数组，用完后调用 unloadWaveSamples() 释放。
      *
      * @param Wave $wave Wave对象
-     * @return array<float> 浮点数组
+     * @return WaveSamples 样本视图
+     * @throws \RuntimeException 如果加载失败
      */
-    public static function loadWaveSamples(Wave $wave): array
+    public static function loadWaveSamples(Wave $wave): WaveSamples
     {
         $samples = self::ffi()->LoadWaveSamples($wave->struct());
-        $arr = [];
-        foreach ($samples as $sample) {
-            $arr[] = $sample;
+        if (\FFI::isNull($samples)) {
+            throw new \RuntimeException("Unable to load wave samples");
         }
-        return $arr;
+        return new WaveSamples($samples, $wave->frameCount, $wave->channels, $wave->sampleRate);
     }
 
     /**
      * 卸载Wave采样数据
      *
-     * @param array<float> $samples 浮点数组指针
+     * @param WaveSamples $samples loadWaveSamples() 返回的样本视图（不能是切片）
      * @return void
      */
-    public static function unloadWaveSamples(array $samples): void
+    public static function unloadWaveSamples(WaveSamples $samples): void
     {
-        $c_floats = self::ffi()->new("float[" . count($samples) . "]");
-        for ($i = 0; $i < count($samples); $i++) {
-            $c_float = self::ffi()->new("float");
-            $c_float->value = $samples[$i];
-            $c_floats[$i] = $c_float;
-        }
-        self::ffi()->UnloadWaveSamples(self::ffi()::addr($c_floats));
+        $samples->unload();
     }
 
     //### 音乐流管理函数
@@ -401,18 +434,25 @@ class Audio extends Base
     /**
      * 从内存加载音乐流
      *
+     * 流式解码器在播放期间一直读取这块内存，因此数据只复制一次到原生缓冲区，
+     * 缓冲区由返回的 Music 持有，unloadMusicStream() 之后释放。
+     *
      * @param string $fileType 文件类型（例如".ogg", ".mp3"）
-     * @param string $data 数据指针
-     * @param int $dataSize 数据大小
+     * @param string $data 文件数据
+     * @param int|null $dataSize 数据大小，null 表示整个字符串
      * @return Music Music对象
+     * @throws \InvalidArgumentException 如果数据大小超出字符串长度
      */
-    public static function loadMusicStreamFromMemory(string $fileType, string $data, int $dataSize): Music
+    public static function loadMusicStreamFromMemory(string $fileType, string $data, ?int $dataSize = null): Music
     {
-        $c_data = self::ffi()->new("char[" . $dataSize . "]");
-        for ($i = 0; $i < $dataSize; $i++) {
-            $c_data[$i] = ord($data[$i]);
+        $dataSize ??= strlen($data);
+        if ($dataSize < 0 || $dataSize > strlen($data)) {
+            throw new \InvalidArgumentException("Data size " . $dataSize . " exceeds the " . strlen($data) . " bytes given");
         }
-        return new Music(self::ffi()->LoadMusicStreamFromMemory($fileType, self::ffi()::addr($c_data), $dataSize));
+        $buffer = self::ffi()->new('unsigned char[' . max(1, $dataSize) . ']');
+        \FFI::memcpy($buffer, $data, $dataSize);
+        $music = self::ffi()->LoadMusicStreamFromMemory($fileType, $buffer, $dataSize);
+        return new Music($music, \FFI::isNull($music->ctxData) ? null : $buffer);
     }
 
     /**
@@ -435,6 +475,7 @@ class Audio extends Base
     public static function unloadMusicStream(Music $music): void
     {
         self::ffi()->UnloadMusicStream($music->struct());
+        $music->releaseSource();
     }
 
     /**
@@ -617,12 +658,16 @@ class Audio extends Base
      * @param string $data 数据
      * @param int $frameCount 帧数
      * @return void
+     * @throws \InvalidArgumentException 如果数据不足 $frameCount 帧
      */
     public static function updateAudioStream(AudioStream $stream, string $data, int $frameCount): void
     {
-        $c_char = self::ffi()->new('char[' . strlen($data) . ']');
-        self::ffi()::memcpy($c_char, $data, strlen($data));
-        self::ffi()->UpdateAudioStream($stream->struct(), self::ffi()->cast('void*', $c_char), $frameCount);
+        // const void * 参数直接传入字符串，不再复制到临时数组
+        $frameSize = intdiv($stream->sampleSize, 8) * $stream->channels;
+        if ($frameSize > 0 && $frameCount * $frameSize > strlen($data)) {
+            throw new \InvalidArgumentException("Audio data holds fewer than " . $frameCount . " frames");
+        }
+        self::ffi()->UpdateAudioStream($stream->struct(), $data, $frameCount);
     }
 
     /**
@@ -738,9 +783,49 @@ class Audio extends Base
         self::ffi()->SetAudioStreamBufferSizeDefault($size);
     }
 
+    /**
+     * 加载绑定环形缓冲区的音频流
+     *
+     * 先把新音频流的子缓冲区大小设为 $periodFrames，使每次 pump() 正好填满一个子缓冲区，
+     * 之后恢复为 raylib 默认值。周期小于音频设备的周期时 raylib 会用设备周期，提交的数据会被静音补齐，
+     * 48kHz 下 1024 帧（约 21ms）以上一般都安全。
+     *
+     * @param int $sampleRate 采样率
+     * @param int $sampleSize 采样大小（位数）：8、16、32
+     * @param int $channels 声道数
+     * @param int $periodFrames 每次提交的帧数
+     * @param int $periods 缓冲区容量（周期数）
+     * @return AudioRingBuffer 环形缓冲区，stream() 为绑定的音频流
+     */
+    public static function loadAudioRingBuffer(int $sampleRate, int $sampleSize, int $channels, int $periodFrames = 1024, int $periods = 8): AudioRingBuffer
+    {
+        self::ffi()->SetAudioStreamBufferSizeDefault($periodFrames);
+        try {
+            $stream = self::loadAudioStream($sampleRate, $sampleSize, $channels);
+        } finally {
+            self::ffi()->SetAudioStreamBufferSizeDefault(0);
+        }
+        return new AudioRingBuffer($stream, $periodFrames, $periodFrames * max(1, $periods));
+    }
+
+    /**
+     * 卸载环形缓冲区绑定的音频流
+     *
+     * @param AudioRingBuffer $ring 环形缓冲区
+     * @return void
+     */
+    public static function unloadAudioRingBuffer(AudioRingBuffer $ring): void
+    {
+        $ring->clear();
+        self::unloadAudioStream($ring->stream());
+    }
+
     /**
      * 设置音频流回调函数（用于请求新数据）
      *
+     * 回调在 raylib 的音频线程中进入 PHP，每个缓冲区都要切换到 PHP 虚拟机，容易卡顿且不是线程安全的。
+     * 实时处理建议用 AudioChain 在主线程按块处理后写入 AudioRingBuffer（见 Audio::loadAudioRingBuffer()）。
+     *
      * @param AudioStream $stream AudioStream对象
      * @param callable $callback 回调函数
      * @return void
@@ -753,6 +838,8 @@ class Audio extends Base
     /**
      * 附加音频流处理器（接收float格式采样）
      *
+     * 处理器同样在音频线程中回调 PHP，见 setAudioStreamCallback() 的说明，效果处理可以用 AudioChain 代替。
+     *
      * @param AudioStream $stream AudioStream对象
      * @param callable $processor 处理器函数
      * @return void
@@ -777,6 +864,8 @@ class Audio extends Base
     /**
      * 附加全局音频混合处理器
      *
+     * 混合处理器对所有声音生效，同样在音频线程中回调 PHP；只处理自己生成的声音时用 AudioChain。
+     *
      * @param callable $processor 处理器函数
      * @return void
      */
@@ -10,27 +10,160 @@ namespace Kingbes\Raylib;
  */
 abstract class Base
 {
+    // FFI 作用域名称（opcache.preload 预加载时使用）
+    public const FFI_SCOPE = 'raylib';
+
+    // 头文件模块（src/include/*.h），按此顺序拼接在 types.h 之后
+    public const MODULES = ['core', 'shapes', 'textures', 'text', 'models', 'audio', 'raymath', 'raygui'];
+
+    // 当前类调用的头文件模块（可以是多个），null 表示只用到类型定义
+    protected const MODULE = null;
+
     // private \FFI $ffi;
     private static \FFI $ffi;
 
+    // 需要解析的头文件模块
+    private static array $modules = self::MODULES;
+
+    // 已检查过模块的类 => FFI 实例
+    private static array $scopes = [];
+
     /**
      * 获取 FFI 实例
      *
+     * 优先使用 opcache.preload 预加载的 FFI 作用域，
+     * 未预加载时才拼接所需模块的头文件并调用 FFI::cdef() 解析。
+     *
      * @return \FFI
      * @throws RuntimeException Missing Raylib dependencies.
      */
     public static function ffi(): \FFI
     {
-        if (!isset(self::$ffi)) {
-            $headerPath = __DIR__ . '/Raylib.h';
-            $dllPath = self::getLibFilePath();
+        return self::$scopes[static::class] ??= self::load(static::MODULE);
+    }
+
+    /**
+     * 设置需要解析的头文件模块
+     *
+     * 只用到部分模块的程序（如只用 Math 或 Textures 图像处理）可以在首次调用前
+     * 缩小解析范围，减少启动耗时和 FFI 符号表内存。默认解析全部模块。
+     * 所有模块共用一个 FFI 实例，因为不同实例的结构体类型互不兼容，无法互相传参。
+     *
+     * @param string ...$modules 模块名，见 Base::MODULES
+     * @return void
+     * @throws \RuntimeException 如果模块不存在或 FFI 已经初始化
+     */
+    public static function modules(string ...$modules): void
+    {
+        if (isset(self::$ffi)) {
+            throw new \RuntimeException("FFI is already initialized, call Base::modules() before the first raylib call");
+        }
+        $unknown = array_diff($modules, self::MODULES);
+        if ($unknown) {
+            throw new \RuntimeException("Unknown raylib module: " . implode(', ', $unknown));
+        }
+        self::$modules = array_values(array_intersect(self::MODULES, $modules));
+    }
 
-            $libHeader = file_get_contents($headerPath);
-            self::$ffi = \FFI::cdef($libHeader, $dllPath);
+    /**
+     * 初始化 FFI 实例并检查模块是否已解析
+     *
+     * @param string|array<string>|null $module 模块名
+     * @return \FFI
+     * @throws \RuntimeException 如果模块未被解析
+     */
+    private static function load(string|array|null $module): \FFI
+    {
+        if (!isset(self::$ffi)) {
+            self::$ffi = self::scope() ?? \FFI::cdef(self::header(), self::getLibFilePath());
+        }
+        foreach ((array)$module as $name) {
+            if (!in_array($name, self::$modules, true)) {
+                throw new \RuntimeException("Raylib module '" . $name . "' is not loaded, enable it with Base::modules()");
+            }
         }
         return self::$ffi;
     }
 
+    /**
+     * 拼接类型定义和所需模块的头文件
+     *
+     * @return string
+     */
+    protected static function header(): string
+    {
+        $header = file_get_contents(__DIR__ . '/include/types.h');
+        foreach (self::$modules as $module) {
+            $header .= PHP_EOL . file_get_contents(__DIR__ . '/include/' . $module . '.h');
+        }
+        return $header;
+    }
+
+    /**
+     * 预加载 FFI 作用域
+     *
+     * 在 opcache.preload 脚本中调用，头文件只在服务启动时解析一次，
+     * 之后每个请求/进程通过 FFI::scope() 直接获取。
+     * 解析的模块由此前的 Base::modules() 决定。
+     *
+     * @return \FFI
+     * @throws \RuntimeException 如果无法写入带注解的头文件
+     */
+    public static function preload(): \FFI
+    {
+        $path = self::writePreloadHeader();
+        try {
+            $ffi = \FFI::load($path);
+        } finally {
+            @unlink($path);
+        }
+        if ($ffi === null) {
+            throw new \RuntimeException("Failed to preload FFI scope: " . self::FFI_SCOPE);
+        }
+        return $ffi;
+    }
+
+    /**
+     * 查找已预加载的 FFI 作用域
+     *
+     * @return \FFI|null 未预加载时返回 null
+     */
+    protected static function scope(): ?\FFI
+    {
+        try {
+            return \FFI::scope(self::FFI_SCOPE);
+        } catch (\FFI\Exception) {
+            return null;
+        }
+    }
+
+    /**
+     * 生成带 FFI_SCOPE / FFI_LIB 注解的头文件
+     *
+     * FFI::load() 要求库路径写在头文件中，而库路径随系统变化，所以每次预加载时重新生成。
+     * 文件由 tempnam() 以独占方式新建（权限 0600，优先放在包内 build 目录），
+     * 不复用任何已存在的文件，避免其他用户预先放置带自己 FFI_LIB 的头文件；加载后即删除。
+     *
+     * @return string 头文件完整路径
+     * @throws \RuntimeException 如果无法写入头文件
+     */
+    protected static function writePreloadHeader(): string
+    {
+        $header = '#define FFI_SCOPE "' . self::FFI_SCOPE . '"' . PHP_EOL
+            . '#define FFI_LIB "' . addslashes(self::getLibFilePath()) . '"' . PHP_EOL
+            . self::header();
+
+        $path = @tempnam(dirname(__DIR__) . '/build', 'php-raylib-');
+        if ($path === false) {
+            throw new \RuntimeException("Unable to create preload header");
+        }
+        if (file_put_contents($path, $header) === false) {
+            @unlink($path);
+            throw new \RuntimeException("Unable to write preload header: " . $path);
+        }
+        return $path;
+    }
+
     /**
      * 获取 Raylib 库文件的路径
      *
@@ -28,6 +28,9 @@ use Kingbes\Raylib\Utils\AutomationEvent;
  */
 class Core extends Base
 {
+    // 头文件模块
+    protected const MODULE = 'core';
+
     // 窗口相关函数
 
     /**
@@ -629,7 +632,7 @@ class Core extends Base
      */
     public static function clearBackground(Color $color): void
     {
-        self::ffi()->ClearBackground($color->struct());
+        self::ffi()->ClearBackground($color->cdata());
     }
 
     /**
@@ -1079,12 +1082,7 @@ class Core extends Base
     public static function getCameraMatrix(Camera3D $camera): Matrix
     {
         $c_matrix = self::ffi()->GetCameraMatrix($camera->struct());
-        return new Matrix(
-            [$c_matrix->m0, $c_matrix->m1, $c_matrix->m2, $c_matrix->m3],
-            [$c_matrix->m4, $c_matrix->m5, $c_matrix->m6, $c_matrix->m7],
-            [$c_matrix->m8, $c_matrix->m9, $c_matrix->m10, $c_matrix->m11],
-            [$c_matrix->m12, $c_matrix->m13, $c_matrix->m14, $c_matrix->m15]
-        );
+        return Matrix::fromStruct($c_matrix);
     }
 
     /**
@@ -1096,12 +1094,7 @@ class Core extends Base
     public static function getCameraMatrix2D(Camera2D $camera): Matrix
     {
         $c_matrix = self::ffi()->GetCameraMatrix2D($camera->struct());
-        return new Matrix(
-            [$c_matrix->m0, $c_matrix->m1, $c_matrix->m2, $c_matrix->m3],
-            [$c_matrix->m4, $c_matrix->m5, $c_matrix->m6, $c_matrix->m7],
-            [$c_matrix->m8, $c_matrix->m9, $c_matrix->m10, $c_matrix->m11],
-            [$c_matrix->m12, $c_matrix->m13, $c_matrix->m14, $c_matrix->m15]
-        );
+        return Matrix::fromStruct($c_matrix);
     }
 
     //### 时间相关函数
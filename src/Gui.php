@@ -17,6 +17,8 @@ use Kingbes\Raylib\Utils\Vector2;
  */
 class Gui extends Base
 {
+    // 头文件模块
+    protected const MODULE = 'raygui';
 
     /**
      * 启用gui控件（全局状态）
@@ -258,7 +260,7 @@ class Gui extends Base
      */
     public static function drawIcon(int $iconId, int $posX, int $posY, int $pixelSize, Color $color): void
     {
-        self::ffi()->GuiDrawIcon($iconId, $posX, $posY, $pixelSize, $color->struct());
+        self::ffi()->GuiDrawIcon($iconId, $posX, $posY, $pixelSize, $color->cdata());
     }
 
     /**
@@ -940,7 +942,7 @@ class Gui extends Base
     public static function colorPicker(Rectangle $bounds, string $title, color &$color): int
     {
         $c_color = self::ffi()->new('color [1]');
-        $c_color[0] = $color->struct();
+        $c_color[0] = $color->cdata();
         $cc_color = self::ffi()->cast('color *', $c_color);
         $res = self::ffi()->GuiColorPicker(
             $bounds->struct(),
@@ -967,7 +969,7 @@ class Gui extends Base
     public static function colorPanel(Rectangle $bounds, string $title, color &$color): int
     {
         $c_color = self::ffi()->new('color [1]');
-        $c_color[0] = $color->struct();
+        $c_color[0] = $color->cdata();
         $cc_color = self::ffi()->cast('color *', $c_color);
         $res = self::ffi()->GuiColorPanel($bounds->struct(), $title, $cc_color);
         $color->r = $cc_color[0]->r;
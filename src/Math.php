@@ -6,6 +6,7 @@ declare(strict_types=1);
 namespace Kingbes\Raylib;
 
 use FFI\CData;
+use FFI\CType;
 use Kingbes\Raylib\Utils\Vector2;
 use Kingbes\Raylib\Utils\Matrix;
 use Kingbes\Raylib\Utils\Vector3;
@@ -16,6 +17,9 @@ use Kingbes\Raylib\Utils\Vector4;
  */
 class Math extends Base
 {
+    // 头文件模块
+    protected const MODULE = 'raymath';
+
     /**
      * 将一个值限制在最小值和最大值之间
      *
@@ -877,187 +881,6 @@ class Math extends Base
         return new Vector3($res->x, $res->y, $res->z);
     }
 
-    /**
-     * 向量3 投影
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Vector3 $source 向量3
-     * @param Vector3 $target 向量3
-     * @return Vector3 向量3 投影 结果
-     */
-    public static function vector3Project(Vector3 $Vector3, Vector3 $source, Vector3 $target): Vector3
-    {
-        $res = self::ffi()->Vector3Project($Vector3->struct(), $source->struct(), $target->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 拒绝
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Vector3 $onNormal 向量3
-     * @return Vector3 向量3 拒绝 结果
-     */
-    public static function vector3Reject(Vector3 $Vector3, Vector3 $onNormal): Vector3
-    {
-        $res = self::ffi()->Vector3Reject($Vector3->struct(), $onNormal->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 正交化归一化
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Vector3 $v1 向量3
-     * @param Vector3 $v2 向量3
-     * @param Vector3 $v3 向量3
-     * @return Vector3 向量3 正交化归一化 结果
-     */
-    public static function vector3OrthoNormalize(Vector3 $Vector3, Vector3 $v1, Vector3 $v2, Vector3 $v3): Vector3
-    {
-        $res = self::ffi()->Vector3OrthoNormalize($Vector3->struct(), $v1->struct(), $v2->struct(), $v3->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 变换
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Matrix $matrix 矩阵
-     * @return Vector3 向量3 变换 结果
-     */
-    public static function vector3Transform(Vector3 $Vector3, Matrix $matrix): Vector3
-    {
-        $res = self::ffi()->Vector3Transform($Vector3->struct(), $matrix->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 四元数旋转
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Vector4 $quaternion 四元数
-     * @return Vector3 向量3 四元数旋转 结果
-     */
-    public static function vector3RotateByQuaternion(Vector3 $Vector3, Vector4 $quaternion): Vector3
-    {
-        $res = self::ffi()->Vector3RotateByQuaternion($Vector3->struct(), $quaternion->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 轴角旋转
-     *
-     * @param Vector3 $Vector3 向量3        
-     * @param Vector3 $axis 向量3
-     * @param float $angle 角度
-     * @return Vector3 向量3 轴角旋转 结果
-     */
-    public static function vector3RotateByAxisAngle(Vector3 $Vector3, Vector3 $axis, float $angle): Vector3
-    {
-        $res = self::ffi()->Vector3RotateByAxisAngle($Vector3->struct(), $axis->struct(), $angle);
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 移动 towards
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Vector3 $target 向量3
-     * @param float $maxDistanceDelta 最大距离增量
-     * @return Vector3 向量3 移动 towards 结果
-     */
-    public static function vector3MoveTowards(Vector3 $Vector3, Vector3 $target, float $maxDistanceDelta): Vector3
-    {
-        $res = self::ffi()->Vector3MoveTowards($Vector3->struct(), $target->struct(), $maxDistanceDelta);
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 线性插值
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Vector3 $target 向量3
-     * @param float $amount 插值比例
-     * @return Vector3 向量3 线性插值 结果
-     */
-    public static function vector3Lerp(Vector3 $Vector3, Vector3 $target, float $amount): Vector3
-    {
-        $res = self::ffi()->Vector3Lerp($Vector3->struct(), $target->struct(), $amount);
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 三次 Hermite 插值
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Vector3 $start 向量3
-     * @param Vector3 $end 向量3
-     * @param Vector3 $startTangent 向量3
-     * @param Vector3 $endTangent 向量3
-     * @param float $amount 插值比例
-     * @return Vector3 向量3 三次 Hermite 插值 结果
-     */
-    public static function vector3CubicHermite(Vector3 $Vector3, Vector3 $start, Vector3 $end, Vector3 $startTangent, Vector3 $endTangent, float $amount): Vector3
-    {
-        $res = self::ffi()->Vector3CubicHermite($Vector3->struct(), $start->struct(), $end->struct(), $startTangent->struct(), $endTangent->struct(), $amount);
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 反射
-     *
-     * @param Vector3 $Vector3 向量3
-     * @param Vector3 $onNormal 向量3
-     * @return Vector3 向量3 反射 结果
-     */
-    public static function vector3Reflect(Vector3 $Vector3, Vector3 $onNormal): Vector3
-    {
-        $res = self::ffi()->Vector3Reflect($Vector3->struct(), $onNormal->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 最小
-     *
-     * @param Vector3 $Vector3_1 向量3
-     * @param Vector3 $Vector3_2 向量3
-     * @return Vector3 向量3 最小 结果
-     */
-    public static function vector3Min(Vector3 $Vector3_1, Vector3 $Vector3_2): Vector3
-    {
-        $res = self::ffi()->Vector3Min($Vector3_1->struct(), $Vector3_2->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 最大
-     *
-     * @param Vector3 $Vector3_1 向量3
-     * @param Vector3 $Vector3_2 向量3
-     * @return Vector3 向量3 最大 结果
-     */
-    public static function vector3Max(Vector3 $Vector3_1, Vector3 $Vector3_2): Vector3
-    {
-        $res = self::ffi()->Vector3Max($Vector3_1->struct(), $Vector3_2->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
-    /**
-     * 向量3 重心坐标
-     *
-     * @param Vector3 $Vector3_p 向量3
-     * @param Vector3 $Vector3_a 向量3
-     * @param Vector3 $Vector3_b 向量3
-     * @param Vector3 $Vector3_c 向量3
-     * @return Vector3 向量3 重心坐标 结果
-     */
-    public static function vector3Barycenter(Vector3 $Vector3_p, Vector3 $Vector3_a, Vector3 $Vector3_b, Vector3 $Vector3_c): Vector3
-    {
-        $res = self::ffi()->Vector3Barycenter($Vector3_p->struct(), $Vector3_a->struct(), $Vector3_b->struct(), $Vector3_c->struct());
-        return new Vector3($res->x, $res->y, $res->z);
-    }
-
     /**
      * 向量3 反投影
      *
@@ -1453,12 +1276,7 @@ class Math extends Base
     public static function matrixTranspose(Matrix $Matrix): Matrix
     {
         $res = self::ffi()->MatrixTranspose($Matrix->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1470,12 +1288,7 @@ class Math extends Base
     public static function matrixInvert(Matrix $Matrix): Matrix
     {
         $res = self::ffi()->MatrixInvert($Matrix->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1486,12 +1299,7 @@ class Math extends Base
     public static function matrixIdentity(): Matrix
     {
         $res = self::ffi()->MatrixIdentity();
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1504,12 +1312,7 @@ class Math extends Base
     public static function matrixAdd(Matrix $Matrix_left, Matrix $Matrix_right): Matrix
     {
         $res = self::ffi()->MatrixAdd($Matrix_left->struct(), $Matrix_right->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1522,12 +1325,7 @@ class Math extends Base
     public static function matrixSubtract(Matrix $Matrix_left, Matrix $Matrix_right): Matrix
     {
         $res = self::ffi()->MatrixSubtract($Matrix_left->struct(), $Matrix_right->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1540,12 +1338,7 @@ class Math extends Base
     public static function matrixMultiply(Matrix $Matrix_left, Matrix $Matrix_right): Matrix
     {
         $res = self::ffi()->MatrixMultiply($Matrix_left->struct(), $Matrix_right->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1559,12 +1352,7 @@ class Math extends Base
     public static function matrixTranslate(float $x, float $y, float $z): Matrix
     {
         $res = self::ffi()->MatrixTranslate($x, $y, $z);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1577,12 +1365,7 @@ class Math extends Base
     public static function matrixRotate(Vector3 $axis, float $angle): Matrix
     {
         $res = self::ffi()->MatrixRotate($axis->struct(), $angle);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1594,12 +1377,7 @@ class Math extends Base
     public static function matrixRotateX(float $angle): Matrix
     {
         $res = self::ffi()->MatrixRotateX($angle);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1611,12 +1389,7 @@ class Math extends Base
     public static function matrixRotateY(float $angle): Matrix
     {
         $res = self::ffi()->MatrixRotateY($angle);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1628,12 +1401,7 @@ class Math extends Base
     public static function matrixRotateZ(float $angle): Matrix
     {
         $res = self::ffi()->MatrixRotateZ($angle);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1645,12 +1413,7 @@ class Math extends Base
     public static function matrixRotateXYZ(Vector3 $Vector3_angle): Matrix
     {
         $res = self::ffi()->MatrixRotateXYZ($Vector3_angle->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1662,12 +1425,7 @@ class Math extends Base
     public static function matrixRotateZYX(Vector3 $Vector3_angle): Matrix
     {
         $res = self::ffi()->MatrixRotateZYX($Vector3_angle->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1681,12 +1439,7 @@ class Math extends Base
     public static function matrixScale(float $x, float $y, float $z): Matrix
     {
         $res = self::ffi()->MatrixScale($x, $y, $z);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1703,12 +1456,7 @@ class Math extends Base
     public static function matrixFrustum(float $left, float $right, float $bottom, float $top, float $nearPlane, float $farPlane): Matrix
     {
         $res = self::ffi()->MatrixFrustum($left, $right, $bottom, $top, $nearPlane, $farPlane);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1723,12 +1471,7 @@ class Math extends Base
     public static function matrixPerspective(float $fovY, float $aspect, float $nearPlane, float $farPlane): Matrix
     {
         $res = self::ffi()->MatrixPerspective($fovY, $aspect, $nearPlane, $farPlane);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1745,12 +1488,7 @@ class Math extends Base
     public static function matrixOrtho(float $left, float $right, float $bottom, float $top, float $nearPlane, float $farPlane): Matrix
     {
         $res = self::ffi()->MatrixOrtho($left, $right, $bottom, $top, $nearPlane, $farPlane);
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -1764,12 +1502,7 @@ class Math extends Base
     public static function matrixLookAt(Vector3 $Vector3_eye, Vector3 $Vector3_target, Vector3 $Vector3_up): Matrix
     {
         $res = self::ffi()->MatrixLookAt($Vector3_eye->struct(), $Vector3_target->struct(), $Vector3_up->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15]
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -2092,12 +1825,7 @@ class Math extends Base
     public static function quaternionToMatrix(Vector4 $Quaternion): Matrix
     {
         $res = self::ffi()->QuaternionToMatrix($Quaternion->struct());
-        return new Matrix(
-            [$res->m0, $res->m4, $res->m8, $res->m12],
-            [$res->m1, $res->m5, $res->m9, $res->m13],
-            [$res->m2, $res->m6, $res->m10, $res->m14],
-            [$res->m3, $res->m7, $res->m11, $res->m15],
-        );
+        return Matrix::fromStruct($res);
     }
 
     /**
@@ -2220,7 +1948,7 @@ class Math extends Base
         $translation = self::ffi()->cast('Vector3 *', $translation->struct());
         $rotation = self::ffi()->cast('Vector4 *', $rotation->struct());
         $scale = self::ffi()->cast('Vector3 *', $scale->struct());
-        self::ffi()->MatrixDecompose($mat, $translation, $rotation, $scale);
+        self::ffi()->MatrixDecompose($mat->struct(), $translation, $rotation, $scale);
         $translation = new Vector3(
             $translation[0]->x,
             $translation[0]->y,
@@ -2241,4 +1969,159 @@ class Math extends Base
         unset($rotation);
         unset($scale);
     }
+
+    //### 批量运算
+    //> 缓冲区为连续的 float（float[]、Vector2[]、Vector3[] 或 Vector2Buffer::struct()），
+    //> 整批只取一次矩阵，直接读写 C 内存，不再逐个调用 raymath、分配结构体和创建对象。
+    //> dst 可以与 src 相同（原地运算）。数组缓冲区小于 count 个向量时抛出异常，指针缓冲区由调用方保证大小。
+
+    /**
+     * 批量 向量2 变换
+     *
+     * @param CData $dst 输出缓冲区（count 个 Vector2）
+     * @param CData $src 输入缓冲区（count 个 Vector2）
+     * @param integer $count 向量数量
+     * @param Matrix $matrix 矩阵
+     * @return void
+     * @throws \InvalidArgumentException 如果数组缓冲区小于 count 个向量
+     */
+    public static function vector2TransformBatch(CData $dst, CData $src, int $count, Matrix $matrix): void
+    {
+        $m = $matrix->struct();
+        [$m0, $m1, $m4, $m5, $m12, $m13] = [$m->m0, $m->m1, $m->m4, $m->m5, $m->m12, $m->m13];
+        $in = self::floats($src, $count * 2);
+        $out = self::floats($dst, $count * 2);
+        for ($i = 0, $n = $count * 2; $i < $n; $i += 2) {
+            $x = $in[$i];
+            $y = $in[$i + 1];
+            $out[$i] = $m0 * $x + $m4 * $y + $m12;
+            $out[$i + 1] = $m1 * $x + $m5 * $y + $m13;
+        }
+    }
+
+    /**
+     * 批量 向量3 变换
+     *
+     * @param CData $dst 输出缓冲区（count 个 Vector3）
+     * @param CData $src 输入缓冲区（count 个 Vector3）
+     * @param integer $count 向量数量
+     * @param Matrix $matrix 矩阵
+     * @return void
+     * @throws \InvalidArgumentException 如果数组缓冲区小于 count 个向量
+     */
+    public static function vector3TransformBatch(CData $dst, CData $src, int $count, Matrix $matrix): void
+    {
+        $m = $matrix->struct();
+        [$m0, $m1, $m2, $m4, $m5, $m6] = [$m->m0, $m->m1, $m->m2, $m->m4, $m->m5, $m->m6];
+        [$m8, $m9, $m10, $m12, $m13, $m14] = [$m->m8, $m->m9, $m->m10, $m->m12, $m->m13, $m->m14];
+        $in = self::floats($src, $count * 3);
+        $out = self::floats($dst, $count * 3);
+        for ($i = 0, $n = $count * 3; $i < $n; $i += 3) {
+            $x = $in[$i];
+            $y = $in[$i + 1];
+            $z = $in[$i + 2];
+            $out[$i] = $m0 * $x + $m4 * $y + $m8 * $z + $m12;
+            $out[$i + 1] = $m1 * $x + $m5 * $y + $m9 * $z + $m13;
+            $out[$i + 2] = $m2 * $x + $m6 * $y + $m10 * $z + $m14;
+        }
+    }
+
+    /**
+     * 批量 向量2 线性插值
+     *
+     * @param CData $dst 输出缓冲区（count 个 Vector2）
+     * @param CData $start 起点缓冲区（count 个 Vector2）
+     * @param CData $end 终点缓冲区（count 个 Vector2）
+     * @param integer $count 向量数量
+     * @param float $amount 插值比例
+     * @return void
+     * @throws \InvalidArgumentException 如果数组缓冲区小于 count 个向量
+     */
+    public static function vector2LerpBatch(CData $dst, CData $start, CData $end, int $count, float $amount): void
+    {
+        $a = self::floats($start, $count * 2);
+        $b = self::floats($end, $count * 2);
+        $out = self::floats($dst, $count * 2);
+        for ($i = 0, $n = $count * 2; $i < $n; $i++) {
+            $out[$i] = $a[$i] + $amount * ($b[$i] - $a[$i]);
+        }
+    }
+
+    /**
+     * 批量 向量2 归一化
+     *
+     * @param CData $dst 输出缓冲区（count 个 Vector2）
+     * @param CData $src 输入缓冲区（count 个 Vector2）
+     * @param integer $count 向量数量
+     * @return void
+     * @throws \InvalidArgumentException 如果数组缓冲区小于 count 个向量
+     */
+    public static function vector2NormalizeBatch(CData $dst, CData $src, int $count): void
+    {
+        $in = self::floats($src, $count * 2);
+        $out = self::floats($dst, $count * 2);
+        for ($i = 0, $n = $count * 2; $i < $n; $i += 2) {
+            $x = $in[$i];
+            $y = $in[$i + 1];
+            $length = sqrt($x * $x + $y * $y);
+            if ($length > 0) {
+                $x /= $length;
+                $y /= $length;
+            }
+            $out[$i] = $x;
+            $out[$i + 1] = $y;
+        }
+    }
+
+    /**
+     * 批量 向量3 归一化
+     *
+     * @param CData $dst 输出缓冲区（count 个 Vector3）
+     * @param CData $src 输入缓冲区（count 个 Vector3）
+     * @param integer $count 向量数量
+     * @return void
+     * @throws \InvalidArgumentException 如果数组缓冲区小于 count 个向量
+     */
+    public static function vector3NormalizeBatch(CData $dst, CData $src, int $count): void
+    {
+        $in = self::floats($src, $count * 3);
+        $out = self::floats($dst, $count * 3);
+        for ($i = 0, $n = $count * 3; $i < $n; $i += 3) {
+            $x = $in[$i];
+            $y = $in[$i + 1];
+            $z = $in[$i + 2];
+            $length = sqrt($x * $x + $y * $y + $z * $z);
+            if ($length != 0) {
+                $x /= $length;
+                $y /= $length;
+                $z /= $length;
+            }
+            $out[$i] = $x;
+            $out[$i + 1] = $y;
+            $out[$i + 2] = $z;
+        }
+    }
+
+    /**
+     * 把缓冲区看作 float*（不复制）
+     *
+     * 数组和结构体取首地址再转换：直接转换只有 float[] 会取地址，
+     * Vector2[]/Vector3[] 会把前 8 字节的 float 数据当成指针。
+     * 指针无法得知大小，由调用方保证。
+     *
+     * @param CData $buffer 缓冲区（数组、结构体或指针）
+     * @param integer $floats 需要访问的 float 数量
+     * @return CData
+     * @throws \InvalidArgumentException 如果数组或结构体小于 $floats 个 float
+     */
+    private static function floats(CData $buffer, int $floats): CData
+    {
+        if (\FFI::typeof($buffer)->getKind() === CType::TYPE_POINTER) {
+            return self::ffi()->cast('float *', $buffer);
+        }
+        if ($floats * 4 > \FFI::sizeof($buffer)) {
+            throw new \InvalidArgumentException("Buffer holds fewer than " . $floats . " floats");
+        }
+        return self::ffi()->cast('float *', \FFI::addr($buffer));
+    }
 }
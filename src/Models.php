@@ -25,6 +25,8 @@ use Kingbes\Raylib\Utils\RayCollision;
  */
 class Models extends Base
 {
+    // 头文件模块
+    protected const MODULE = 'models';
 
     //### 基本3D几何形状绘制函数
 
@@ -38,7 +40,7 @@ class Models extends Base
      */
     public static function drawLine3D(Vector3 $startPos, Vector3 $endPos, Color $color): void
     {
-        self::ffi()->DrawLine3D($startPos->struct(), $endPos->struct(), $color->struct());
+        self::ffi()->DrawLine3D($startPos->struct(), $endPos->struct(), $color->cdata());
     }
 
     /**
@@ -50,7 +52,7 @@ class Models extends Base
      */
     public static function drawPoint3D(Vector3 $position, Color $color): void
     {
-        self::ffi()->DrawPoint3D($position->struct(), $color->struct());
+        self::ffi()->DrawPoint3D($position->struct(), $color->cdata());
     }
 
     /**
@@ -65,7 +67,7 @@ class Models extends Base
      */
     public static function drawCircle3D(Vector3 $center, float $radius, Vector3 $rotationAxis, float $rotationAngle, Color $color): void
     {
-        self::ffi()->DrawCircle3D($center->struct(), $radius, $rotationAxis->struct(), $rotationAngle, $color->struct());
+        self::ffi()->DrawCircle3D($center->struct(), $radius, $rotationAxis->struct(), $rotationAngle, $color->cdata());
     }
 
     /**
@@ -79,7 +81,7 @@ class Models extends Base
      */
     public static function drawTriangle3D(Vector3 $v1, Vector3 $v2, Vector3 $v3, Color $color): void
     {
-        self::ffi()->DrawTriangle3D($v1->struct(), $v2->struct(), $v3->struct(), $color->struct());
+        self::ffi()->DrawTriangle3D($v1->struct(), $v2->struct(), $v3->struct(), $color->cdata());
     }
 
     /**
@@ -97,7 +99,7 @@ class Models extends Base
         foreach ($points as $i => $p) {
             $cPoints[$i] = $p->struct();
         }
-        self::ffi()->DrawTriangleStrip3D(self::ffi()->cast("Vector3*", $cPoints), $pointCount, $color->struct());
+        self::ffi()->DrawTriangleStrip3D(self::ffi()->cast("Vector3*", $cPoints), $pointCount, $color->cdata());
     }
 
     /**
@@ -112,7 +114,7 @@ class Models extends Base
      */
     public static function drawCube(Vector3 $position, float $width, float $height, float $length, Color $color): void
     {
-        self::ffi()->DrawCube($position->struct(), $width, $height, $length, $color->struct());
+        self::ffi()->DrawCube($position->struct(), $width, $height, $length, $color->cdata());
     }
 
     /**
@@ -125,7 +127,7 @@ class Models extends Base
      */
     public static function drawCubeV(Vector3 $position, Vector3 $size, Color $color): void
     {
-        self::ffi()->DrawCubeV($position->struct(), $size->struct(), $color->struct());
+        self::ffi()->DrawCubeV($position->struct(), $size->struct(), $color->cdata());
     }
 
     /**
@@ -140,7 +142,7 @@ class Models extends Base
      */
     public static function drawCubeWires(Vector3 $position, float $width, float $height, float $length, Color $color): void
     {
-        self::ffi()->DrawCubeWires($position->struct(), $width, $height, $length, $color->struct());
+        self::ffi()->DrawCubeWires($position->struct(), $width, $height, $length, $color->cdata());
     }
 
     /**
@@ -153,7 +155,7 @@ class Models extends Base
      */
     public static function drawCubeWiresV(Vector3 $position, Vector3 $size, Color $color): void
     {
-        self::ffi()->DrawCubeWiresV($position->struct(), $size->struct(), $color->struct());
+        self::ffi()->DrawCubeWiresV($position->struct(), $size->struct(), $color->cdata());
     }
 
     /**
@@ -166,7 +168,7 @@ class Models extends Base
      */
     public static function drawSphere(Vector3 $centerPos, float $radius, Color $color): void
     {
-        self::ffi()->DrawSphere($centerPos->struct(), $radius, $color->struct());
+        self::ffi()->DrawSphere($centerPos->struct(), $radius, $color->cdata());
     }
 
     /**
@@ -181,7 +183,7 @@ class Models extends Base
      */
     public static function drawSphereEx(Vector3 $centerPos, float $radius, int $rings, int $slices, Color $color): void
     {
-        self::ffi()->DrawSphereEx($centerPos->struct(), $radius, $rings, $slices, $color->struct());
+        self::ffi()->DrawSphereEx($centerPos->struct(), $radius, $rings, $slices, $color->cdata());
     }
 
     /**
@@ -196,7 +198,7 @@ class Models extends Base
      */
     public static function drawSphereWires(Vector3 $centerPos, float $radius, int $rings, int $slices, Color $color): void
     {
-        self::ffi()->DrawSphereWires($centerPos->struct(), $radius, $rings, $slices, $color->struct());
+        self::ffi()->DrawSphereWires($centerPos->struct(), $radius, $rings, $slices, $color->cdata());
     }
 
     /**
@@ -212,7 +214,7 @@ class Models extends Base
      */
     public static function drawCylinder(Vector3 $position, float $radiusTop, float $radiusBottom, float $height, int $slices, Color $color): void
     {
-        self::ffi()->DrawCylinder($position->struct(), $radiusTop, $radiusBottom, $height, $slices, $color->struct());
+        self::ffi()->DrawCylinder($position->struct(), $radiusTop, $radiusBottom, $height, $slices, $color->cdata());
     }
 
     /**
@@ -228,7 +230,7 @@ class Models extends Base
      */
     public static function drawCylinderEx(Vector3 $startPos, Vector3 $endPos, float $startRadius, float $endRadius, int $sides, Color $color): void
     {
-        self::ffi()->DrawCylinderEx($startPos->struct(), $endPos->struct(), $startRadius, $endRadius, $sides, $color->struct());
+        self::ffi()->DrawCylinderEx($startPos->struct(), $endPos->struct(), $startRadius, $endRadius, $sides, $color->cdata());
     }
 
     /**
@@ -244,7 +246,7 @@ class Models extends Base
      */
     public static function drawCylinderWires(Vector3 $position, float $radiusTop, float $radiusBottom, float $height, int $slices, Color $color): void
     {
-        self::ffi()->DrawCylinderWires($position->struct(), $radiusTop, $radiusBottom, $height, $slices, $color->struct());
+        self::ffi()->DrawCylinderWires($position->struct(), $radiusTop, $radiusBottom, $height, $slices, $color->cdata());
     }
 
     /**
@@ -260,7 +262,7 @@ class Models extends Base
      */
     public static function drawCylinderWiresEx(Vector3 $startPos, Vector3 $endPos, float $startRadius, float $endRadius, int $sides, Color $color): void
     {
-        self::ffi()->DrawCylinderWiresEx($startPos->struct(), $endPos->struct(), $startRadius, $endRadius, $sides, $color->struct());
+        self::ffi()->DrawCylinderWiresEx($startPos->struct(), $endPos->struct(), $startRadius, $endRadius, $sides, $color->cdata());
     }
 
     /**
@@ -276,7 +278,7 @@ class Models extends Base
      */
     public static function drawCapsule(Vector3 $startPos, Vector3 $endPos, float $radius, int $slices, int $rings, Color $color): void
     {
-        self::ffi()->DrawCapsule($startPos->struct(), $endPos->struct(), $radius, $slices, $rings, $color->struct());
+        self::ffi()->DrawCapsule($startPos->struct(), $endPos->struct(), $radius, $slices, $rings, $color->cdata());
     }
 
     /**
@@ -292,7 +294,7 @@ class Models extends Base
      */
     public static function drawCapsuleWires(Vector3 $startPos, Vector3 $endPos, float $radius, int $slices, int $rings, Color $color): void
     {
-        self::ffi()->DrawCapsuleWires($startPos->struct(), $endPos->struct(), $radius, $slices, $rings, $color->struct());
+        self::ffi()->DrawCapsuleWires($startPos->struct(), $endPos->struct(), $radius, $slices, $rings, $color->cdata());
     }
 
     /**
@@ -305,7 +307,7 @@ class Models extends Base
      */
     public static function drawPlane(Vector3 $centerPos, Vector2 $size, Color $color): void
     {
-        self::ffi()->DrawPlane($centerPos->struct(), $size->struct(), $color->struct());
+        self::ffi()->DrawPlane($centerPos->struct(), $size->struct(), $color->cdata());
     }
 
     /**
@@ -317,7 +319,7 @@ class Models extends Base
      */
     public static function drawRay(Ray $ray, Color $color): void
     {
-        self::ffi()->DrawRay($ray->struct(), $color->struct());
+        self::ffi()->DrawRay($ray->struct(), $color->cdata());
     }
 
     /**
@@ -400,7 +402,7 @@ class Models extends Base
      */
     public static function drawModel(Model $model, Vector3 $position, float $scale, Color $tint): void
     {
-        self::ffi()->DrawModel($model->struct(), $position->struct(), $scale, $tint->struct());
+        self::ffi()->DrawModel($model->struct(), $position->struct(), $scale, $tint->cdata());
     }
 
     /**
@@ -416,7 +418,7 @@ class Models extends Base
      */
     public static function drawModelEx(Model $model, Vector3 $position, Vector3 $rotationAxis, float $rotationAngle, Vector3 $scale, Color $tint): void
     {
-        self::ffi()->DrawModelEx($model->struct(), $position->struct(), $rotationAxis->struct(), $rotationAngle, $scale->struct(), $tint->struct());
+        self::ffi()->DrawModelEx($model->struct(), $position->struct(), $rotationAxis->struct(), $rotationAngle, $scale->struct(), $tint->cdata());
     }
 
     /**
@@ -430,7 +432,7 @@ class Models extends Base
      */
     public static function drawModelWires(Model $model, Vector3 $position, float $scale, Color $tint): void
     {
-        self::ffi()->DrawModelWires($model->struct(), $position->struct(), $scale, $tint->struct());
+        self::ffi()->DrawModelWires($model->struct(), $position->struct(), $scale, $tint->cdata());
     }
 
     /**
@@ -446,7 +448,7 @@ class Models extends Base
      */
     public static function drawModelWiresEx(Model $model, Vector3 $position, Vector3 $rotationAxis, float $rotationAngle, Vector3 $scale, Color $tint): void
     {
-        self::ffi()->DrawModelWiresEx($model->struct(), $position->struct(), $rotationAxis->struct(), $rotationAngle, $scale->struct(), $tint->struct());
+        self::ffi()->DrawModelWiresEx($model->struct(), $position->struct(), $rotationAxis->struct(), $rotationAngle, $scale->struct(), $tint->cdata());
     }
 
     /**
@@ -460,7 +462,7 @@ class Models extends Base
      */
     public static function drawModelPoints(Model $model, Vector3 $position, float $scale, Color $tint): void
     {
-        self::ffi()->DrawModelPoints($model->struct(), $position->struct(), $scale, $tint->struct());
+        self::ffi()->DrawModelPoints($model->struct(), $position->struct(), $scale, $tint->cdata());
     }
 
     /**
@@ -476,7 +478,7 @@ class Models extends Base
      */
     public static function drawModelPointsEx(Model $model, Vector3 $position, Vector3 $rotationAxis, float $rotationAngle, Vector3 $scale, Color $tint): void
     {
-        self::ffi()->DrawModelPointsEx($model->struct(), $position->struct(), $rotationAxis->struct(), $rotationAngle, $scale->struct(), $tint->struct());
+        self::ffi()->DrawModelPointsEx($model->struct(), $position->struct(), $rotationAxis->struct(), $rotationAngle, $scale->struct(), $tint->cdata());
     }
 
     /**
@@ -488,7 +490,7 @@ class Models extends Base
      */
     public static function drawBoundingBox(BoundingBox $box, Color $color): void
     {
-        self::ffi()->DrawBoundingBox($box->struct(), $color->struct());
+        self::ffi()->DrawBoundingBox($box->struct(), $color->cdata());
     }
 
     /**
@@ -503,7 +505,7 @@ class Models extends Base
      */
     public static function drawBillboard(Camera3D $camera, Texture2D $texture, Vector3 $position, float $scale, Color $tint): void
     {
-        self::ffi()->DrawBillboard($camera->struct(), $texture->struct(), $position->struct(), $scale, $tint->struct());
+        self::ffi()->DrawBillboard($camera->struct(), $texture->struct(), $position->struct(), $scale, $tint->cdata());
     }
 
     /**
@@ -519,7 +521,7 @@ class Models extends Base
      */
     public static function drawBillboardRec(Camera3D $camera, Texture2D $texture, Rectangle $source, Vector3 $position, Vector2 $size, Color $tint): void
     {
-        self::ffi()->DrawBillboardRec($camera->struct(), $texture->struct(), $source->struct(), $position->struct(), $size->struct(), $tint->struct());
+        self::ffi()->DrawBillboardRec($camera->struct(), $texture->struct(), $source->struct(), $position->struct(), $size->struct(), $tint->cdata());
     }
 
     /**
@@ -538,7 +540,7 @@ class Models extends Base
      */
     public static function drawBillboardPro(Camera3D $camera, Texture $texture, Rectangle $source, Vector3 $position, Vector3 $up, Vector2 $size, Vector2 $origin, float $rotation, Color $tint): void
     {
-        self::ffi()->DrawBillboardPro($camera->struct(), $texture->struct(), $source->struct(), $position->struct(), $up->struct(), $size->struct(), $origin->struct(), $rotation, $tint->struct());
+        self::ffi()->DrawBillboardPro($camera->struct(), $texture->struct(), $source->struct(), $position->struct(), $up->struct(), $size->struct(), $origin->struct(), $rotation, $tint->cdata());
     }
 
     //### 网格管理函数
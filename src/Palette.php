@@ -0,0 +1,137 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib;
+
+use Kingbes\Raylib\Utils\Color;
+
+/**
+ * 调色板
+ * 
+ * 预定义颜色和用户注册的颜色都是冻结的 Color，结构体只创建一次，
+ * 绘制函数直接传递，不再重新分配；公开的 struct() 返回副本，共享的颜色值不会被调用方改掉。
+ * 
+ * @method static Color LIGHTGRAY() 浅灰 200,200,200,255
+ * @method static Color GRAY() 灰 130,130,130,255
+ * @method static Color DARKGRAY() 深灰 80,80,80,255
+ * @method static Color YELLOW() 黄 253,249,0,255
+ * @method static Color GOLD() 金 255,203,0,255
+ * @method static Color ORANGE() 橙 255,161,0,255
+ * @method static Color PINK() 粉 255,109,194,255
+ * @method static Color RED() 红 230,41,55,255
+ * @method static Color MAROON() 栗色 190,33,55,255
+ * @method static Color GREEN() 绿 0,228,48,255
+ * @method static Color LIME() 青柠 0,158,47,255
+ * @method static Color DARKGREEN() 深绿 0,117,44,255
+ * @method static Color SKYBLUE() 天蓝 102,191,255,255
+ * @method static Color BLUE() 蓝 0,121,241,255
+ * @method static Color DARKBLUE() 深蓝 0,82,172,255
+ * @method static Color PURPLE() 紫 200,122,255,255
+ * @method static Color VIOLET() 紫罗兰 135,60,190,255
+ * @method static Color DARKPURPLE() 深紫 112,31,126,255
+ * @method static Color BEIGE() 米色 211,176,131,255
+ * @method static Color BROWN() 棕 127,106,79,255
+ * @method static Color DARKBROWN() 深棕 76,63,47,255
+ * @method static Color WHITE() 白 255,255,255,255
+ * @method static Color BLACK() 黑 0,0,0,255
+ * @method static Color BLANK() 透明 0,0,0,0
+ * @method static Color MAGENTA() 洋红 255,0,255,255
+ * @method static Color RAYWHITE() raylib 白 245,245,245,255
+ */
+class Palette extends Base
+{
+    // raylib 预定义颜色
+    public const COLORS = [
+        'LIGHTGRAY' => [200, 200, 200, 255],
+        'GRAY' => [130, 130, 130, 255],
+        'DARKGRAY' => [80, 80, 80, 255],
+        'YELLOW' => [253, 249, 0, 255],
+        'GOLD' => [255, 203, 0, 255],
+        'ORANGE' => [255, 161, 0, 255],
+        'PINK' => [255, 109, 194, 255],
+        'RED' => [230, 41, 55, 255],
+        'MAROON' => [190, 33, 55, 255],
+        'GREEN' => [0, 228, 48, 255],
+        'LIME' => [0, 158, 47, 255],
+        'DARKGREEN' => [0, 117, 44, 255],
+        'SKYBLUE' => [102, 191, 255, 255],
+        'BLUE' => [0, 121, 241, 255],
+        'DARKBLUE' => [0, 82, 172, 255],
+        'PURPLE' => [200, 122, 255, 255],
+        'VIOLET' => [135, 60, 190, 255],
+        'DARKPURPLE' => [112, 31, 126, 255],
+        'BEIGE' => [211, 176, 131, 255],
+        'BROWN' => [127, 106, 79, 255],
+        'DARKBROWN' => [76, 63, 47, 255],
+        'WHITE' => [255, 255, 255, 255],
+        'BLACK' => [0, 0, 0, 255],
+        'BLANK' => [0, 0, 0, 0],
+        'MAGENTA' => [255, 0, 255, 255],
+        'RAYWHITE' => [245, 245, 245, 255],
+    ];
+
+    // 颜色名 => 冻结的 Color
+    private static array $colors = [];
+
+    /**
+     * 获取调色板颜色
+     *
+     * @param string $name 颜色名，如 RAYWHITE
+     * @return Color 冻结的颜色对象
+     * @throws \InvalidArgumentException 如果颜色不存在
+     */
+    public static function get(string $name): Color
+    {
+        if (isset(self::$colors[$name])) {
+            return self::$colors[$name];
+        }
+        if (!isset(self::COLORS[$name])) {
+            throw new \InvalidArgumentException("Unknown palette color: " . $name);
+        }
+        return self::$colors[$name] = (new Color(...self::COLORS[$name]))->freeze();
+    }
+
+    /**
+     * 注册自定义颜色
+     *
+     * @param string $name 颜色名
+     * @param integer $r 红 0-255
+     * @param integer $g 绿 0-255
+     * @param integer $b 蓝 0-255
+     * @param integer $a 透明度 0-255
+     * @return Color 冻结的颜色对象
+     * @throws \InvalidArgumentException 如果颜色名已存在
+     */
+    public static function register(string $name, int $r, int $g, int $b, int $a = 255): Color
+    {
+        if (self::has($name)) {
+            throw new \InvalidArgumentException("Palette color already exists: " . $name);
+        }
+        return self::$colors[$name] = (new Color($r, $g, $b, $a))->freeze();
+    }
+
+    /**
+     * 颜色是否存在
+     *
+     * @param string $name 颜色名
+     * @return bool
+     */
+    public static function has(string $name): bool
+    {
+        return isset(self::$colors[$name]) || isset(self::COLORS[$name]);
+    }
+
+    /**
+     * 按颜色名获取，如 Palette::RAYWHITE()
+     *
+     * @param string $name 颜色名
+     * @param array $arguments 无
+     * @return Color 冻结的颜色对象
+     */
+    public static function __callStatic(string $name, array $arguments): Color
+    {
+        return self::get($name);
+    }
+}
@@ -0,0 +1,118 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib;
+
+/**
+ * 像素格式
+ *
+ * @property int Grayscale 8 位灰度（无透明通道） 1
+ * @property int GrayAlpha 8*2 位灰度+透明（2 通道） 2
+ * @property int R5G6B5 16 位 3
+ * @property int R8G8B8 24 位 4
+ * @property int R5G5B5A1 16 位（1 位透明） 5
+ * @property int R4G4B4A4 16 位（4 位透明） 6
+ * @property int R8G8B8A8 32 位 7
+ * @property int R32 32 位（1 通道 float） 8
+ * @property int R32G32B32 32*3 位（3 通道 float） 9
+ * @property int R32G32B32A32 32*4 位（4 通道 float） 10
+ * @property int R16 16 位（1 通道半精度 float） 11
+ * @property int R16G16B16 16*3 位（3 通道半精度 float） 12
+ * @property int R16G16B16A16 16*4 位（4 通道半精度 float） 13
+ * @property int Dxt1Rgb 4 位（无透明） 14
+ * @property int Dxt1Rgba 4 位（1 位透明） 15
+ * @property int Dxt3Rgba 8 位 16
+ * @property int Dxt5Rgba 8 位 17
+ * @property int Etc1Rgb 4 位 18
+ * @property int Etc2Rgb 4 位 19
+ * @property int Etc2EacRgba 8 位 20
+ * @property int PvrtRgb 4 位 21
+ * @property int PvrtRgba 4 位 22
+ * @property int Astc4x4Rgba 8 位 23
+ * @property int Astc8x8Rgba 2 位 24
+ */
+enum PixelFormat: int
+{
+    case Grayscale = 1;
+    case GrayAlpha = 2;
+    case R5G6B5 = 3;
+    case R8G8B8 = 4;
+    case R5G5B5A1 = 5;
+    case R4G4B4A4 = 6;
+    case R8G8B8A8 = 7;
+    case R32 = 8;
+    case R32G32B32 = 9;
+    case R32G32B32A32 = 10;
+    case R16 = 11;
+    case R16G16B16 = 12;
+    case R16G16B16A16 = 13;
+    case Dxt1Rgb = 14;
+    case Dxt1Rgba = 15;
+    case Dxt3Rgba = 16;
+    case Dxt5Rgba = 17;
+    case Etc1Rgb = 18;
+    case Etc2Rgb = 19;
+    case Etc2EacRgba = 20;
+    case PvrtRgb = 21;
+    case PvrtRgba = 22;
+    case Astc4x4Rgba = 23;
+    case Astc8x8Rgba = 24;
+
+    /**
+     * 每像素位数（与 raylib GetPixelDataSize() 一致，压缩格式为平均值）
+     *
+     * @return integer
+     */
+    public function bitsPerPixel(): int
+    {
+        return match ($this) {
+            self::Grayscale => 8,
+            self::GrayAlpha, self::R5G6B5, self::R5G5B5A1, self::R4G4B4A4, self::R16 => 16,
+            self::R8G8B8 => 24,
+            self::R8G8B8A8, self::R32 => 32,
+            self::R16G16B16 => 48,
+            self::R16G16B16A16 => 64,
+            self::R32G32B32 => 96,
+            self::R32G32B32A32 => 128,
+            self::Dxt1Rgb, self::Dxt1Rgba, self::Etc1Rgb, self::Etc2Rgb, self::PvrtRgb, self::PvrtRgba => 4,
+            self::Dxt3Rgba, self::Dxt5Rgba, self::Etc2EacRgba, self::Astc4x4Rgba => 8,
+            self::Astc8x8Rgba => 2,
+        };
+    }
+
+    /**
+     * 是否为压缩格式
+     *
+     * @return boolean
+     */
+    public function isCompressed(): bool
+    {
+        return $this->value >= self::Dxt1Rgb->value;
+    }
+
+    /**
+     * 未压缩格式的像素布局：[元素类型, 元素字节数, 每像素元素数]，压缩格式返回 null
+     *
+     * 8 位格式为 uint8_t，R32 系列为 float，16 位打包格式和半精度 float（R16 系列）为 uint16_t
+     *
+     * @return array{string, int, int}|null
+     */
+    public function layout(): ?array
+    {
+        return match ($this) {
+            self::Grayscale => ['uint8_t', 1, 1],
+            self::GrayAlpha => ['uint8_t', 1, 2],
+            self::R8G8B8 => ['uint8_t', 1, 3],
+            self::R8G8B8A8 => ['uint8_t', 1, 4],
+            self::R5G6B5, self::R5G5B5A1, self::R4G4B4A4, self::R16 => ['uint16_t', 2, 1],
+            self::R16G16B16 => ['uint16_t', 2, 3],
+            self::R16G16B16A16 => ['uint16_t', 2, 4],
+            self::R32 => ['float', 4, 1],
+            self::R32G32B32 => ['float', 4, 3],
+            self::R32G32B32A32 => ['float', 4, 4],
+            default => null,
+        };
+    }
+}
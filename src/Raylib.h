@@ -1,1979 +0,0 @@
-// Vector2, 2 components
-typedef struct Vector2 {
-    float x;                // Vector x component
-    float y;                // Vector y component
-} Vector2;
-
-// Vector3, 3 components
-typedef struct Vector3 {
-    float x;                // Vector x component
-    float y;                // Vector y component
-    float z;                // Vector z component
-} Vector3;
-
-// Vector4, 4 components
-typedef struct Vector4 {
-    float x;                // Vector x component
-    float y;                // Vector y component
-    float z;                // Vector z component
-    float w;                // Vector w component
-} Vector4;
-
-// Quaternion, 4 components (Vector4 alias)
-typedef Vector4 Quaternion;
-
-// Matrix, 4x4 components, column major, OpenGL style, right-handed
-typedef struct Matrix {
-    float m0, m4, m8, m12;  // Matrix first row (4 components)
-    float m1, m5, m9, m13;  // Matrix second row (4 components)
-    float m2, m6, m10, m14; // Matrix third row (4 components)
-    float m3, m7, m11, m15; // Matrix fourth row (4 components)
-} Matrix;
-
-// Color, 4 components, R8G8B8A8 (32bit)
-typedef struct Color {
-    unsigned char r;        // Color red value
-    unsigned char g;        // Color green value
-    unsigned char b;        // Color blue value
-    unsigned char a;        // Color alpha value
-} Color;
-
-// Rectangle, 4 components
-typedef struct Rectangle {
-    float x;                // Rectangle top-left corner position x
-    float y;                // Rectangle top-left corner position y
-    float width;            // Rectangle width
-    float height;           // Rectangle height
-} Rectangle;
-
-// Image, pixel data stored in CPU memory (RAM)
-typedef struct Image {
-    void *data;             // Image raw data
-    int width;              // Image base width
-    int height;             // Image base height
-    int mipmaps;            // Mipmap levels, 1 by default
-    int format;             // Data format (PixelFormat type)
-} Image;
-
-// Texture, tex data stored in GPU memory (VRAM)
-typedef struct Texture {
-    unsigned int id;        // OpenGL texture id
-    int width;              // Texture base width
-    int height;             // Texture base height
-    int mipmaps;            // Mipmap levels, 1 by default
-    int format;             // Data format (PixelFormat type)
-} Texture;
-
-// Texture2D, same as Texture
-typedef Texture Texture2D;
-
-// TextureCubemap, same as Texture
-typedef Texture TextureCubemap;
-
-// RenderTexture, fbo for texture rendering
-typedef struct RenderTexture {
-    unsigned int id;        // OpenGL framebuffer object id
-    Texture texture;        // Color buffer attachment texture
-    Texture depth;          // Depth buffer attachment texture
-} RenderTexture;
-
-// RenderTexture2D, same as RenderTexture
-typedef RenderTexture RenderTexture2D;
-
-// NPatchInfo, n-patch layout info
-typedef struct NPatchInfo {
-    Rectangle source;       // Texture source rectangle
-    int left;               // Left border offset
-    int top;                // Top border offset
-    int right;              // Right border offset
-    int bottom;             // Bottom border offset
-    int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
-} NPatchInfo;
-
-// GlyphInfo, font characters glyphs info
-typedef struct GlyphInfo {
-    int value;              // Character value (Unicode)
-    int offsetX;            // Character offset X when drawing
-    int offsetY;            // Character offset Y when drawing
-    int advanceX;           // Character advance position X
-    Image image;            // Character image data
-} GlyphInfo;
-
-// Font, font texture and GlyphInfo array data
-typedef struct Font {
-    int baseSize;           // Base size (default chars height)
-    int glyphCount;         // Number of glyph characters
-    int glyphPadding;       // Padding around the glyph characters
-    Texture2D texture;      // Texture atlas containing the glyphs
-    Rectangle *recs;        // Rectangles in texture for the glyphs
-    GlyphInfo *glyphs;      // Glyphs info data
-} Font;
-
-// Camera, defines position/orientation in 3d space
-typedef struct Camera3D {
-    Vector3 position;       // Camera position
-    Vector3 target;         // Camera target it looks-at
-    Vector3 up;             // Camera up vector (rotation over its axis)
-    float fovy;             // Camera field-of-view aperture in Y (degrees) in perspective, used as near plane width in orthographic
-    int projection;         // Camera projection: CAMERA_PERSPECTIVE or CAMERA_ORTHOGRAPHIC
-} Camera3D;
-
-typedef Camera3D Camera;    // Camera type fallback, defaults to Camera3D
-
-// Camera2D, defines position/orientation in 2d space
-typedef struct Camera2D {
-    Vector2 offset;         // Camera offset (displacement from target)
-    Vector2 target;         // Camera target (rotation and zoom origin)
-    float rotation;         // Camera rotation in degrees
-    float zoom;             // Camera zoom (scaling), should be 1.0f by default
-} Camera2D;
-
-// Mesh, vertex data and vao/vbo
-typedef struct Mesh {
-    int vertexCount;        // Number of vertices stored in arrays
-    int triangleCount;      // Number of triangles stored (indexed or not)
-
-    // Vertex attributes data
-    float *vertices;        // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
-    float *texcoords;       // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
-    float *texcoords2;      // Vertex texture second coordinates (UV - 2 components per vertex) (shader-location = 5)
-    float *normals;         // Vertex normals (XYZ - 3 components per vertex) (shader-location = 2)
-    float *tangents;        // Vertex tangents (XYZW - 4 components per vertex) (shader-location = 4)
-    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
-    unsigned short *indices;    // Vertex indices (in case vertex data comes indexed)
-
-    // Animation vertex data
-    float *animVertices;    // Animated vertex positions (after bones transformations)
-    float *animNormals;     // Animated normals (after bones transformations)
-    unsigned char *boneIds; // Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning) (shader-location = 6)
-    float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning) (shader-location = 7)
-    Matrix *boneMatrices;   // Bones animated transformation matrices
-    int boneCount;          // Number of bones
-
-    // OpenGL identifiers
-    unsigned int vaoId;     // OpenGL Vertex Array Object id
-    unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
-} Mesh;
-
-// Shader
-typedef struct Shader {
-    unsigned int id;        // Shader program id
-    int *locs;              // Shader locations array (RL_MAX_SHADER_LOCATIONS)
-} Shader;
-
-// MaterialMap
-typedef struct MaterialMap {
-    Texture2D texture;      // Material map texture
-    Color color;            // Material map color
-    float value;            // Material map value
-} MaterialMap;
-
-// Material, includes shader and maps
-typedef struct Material {
-    Shader shader;          // Material shader
-    MaterialMap *maps;      // Material maps array (MAX_MATERIAL_MAPS)
-    float params[4];        // Material generic parameters (if required)
-} Material;
-
-// Transform, vertex transformation data
-typedef struct Transform {
-    Vector3 translation;    // Translation
-    Quaternion rotation;    // Rotation
-    Vector3 scale;          // Scale
-} Transform;
-
-// Bone, skeletal animation bone
-typedef struct BoneInfo {
-    char name[32];          // Bone name
-    int parent;             // Bone parent
-} BoneInfo;
-
-// Model, meshes, materials and animation data
-typedef struct Model {
-    Matrix transform;       // Local transform matrix
-
-    int meshCount;          // Number of meshes
-    int materialCount;      // Number of materials
-    Mesh *meshes;           // Meshes array
-    Material *materials;    // Materials array
-    int *meshMaterial;      // Mesh material number
-
-    // Animation data
-    int boneCount;          // Number of bones
-    BoneInfo *bones;        // Bones information (skeleton)
-    Transform *bindPose;    // Bones base transformation (pose)
-} Model;
-
-// ModelAnimation
-typedef struct ModelAnimation {
-    int boneCount;          // Number of bones
-    int frameCount;         // Number of animation frames
-    BoneInfo *bones;        // Bones information (skeleton)
-    Transform **framePoses; // Poses array by frame
-    char name[32];          // Animation name
-} ModelAnimation;
-
-// Ray, ray for raycasting
-typedef struct Ray {
-    Vector3 position;       // Ray position (origin)
-    Vector3 direction;      // Ray direction (normalized)
-} Ray;
-
-// RayCollision, ray hit information
-typedef struct RayCollision {
-    bool hit;               // Did the ray hit something?
-    float distance;         // Distance to the nearest hit
-    Vector3 point;          // Point of the nearest hit
-    Vector3 normal;         // Surface normal of hit
-} RayCollision;
-
-// BoundingBox
-typedef struct BoundingBox {
-    Vector3 min;            // Minimum vertex box-corner
-    Vector3 max;            // Maximum vertex box-corner
-} BoundingBox;
-
-// Wave, audio wave data
-typedef struct Wave {
-    unsigned int frameCount;    // Total number of frames (considering channels)
-    unsigned int sampleRate;    // Frequency (samples per second)
-    unsigned int sampleSize;    // Bit depth (bits per sample): 8, 16, 32 (24 not supported)
-    unsigned int channels;      // Number of channels (1-mono, 2-stereo, ...)
-    void *data;                 // Buffer data pointer
-} Wave;
-
-// Opaque structs declaration
-// NOTE: Actual structs are defined internally in raudio module
-typedef struct rAudioBuffer rAudioBuffer;
-typedef struct rAudioProcessor rAudioProcessor;
-
-// AudioStream, custom audio stream
-typedef struct AudioStream {
-    rAudioBuffer *buffer;       // Pointer to internal data used by the audio system
-    rAudioProcessor *processor; // Pointer to internal data processor, useful for audio effects
-
-    unsigned int sampleRate;    // Frequency (samples per second)
-    unsigned int sampleSize;    // Bit depth (bits per sample): 8, 16, 32 (24 not supported)
-    unsigned int channels;      // Number of channels (1-mono, 2-stereo, ...)
-} AudioStream;
-
-// Sound
-typedef struct Sound {
-    AudioStream stream;         // Audio stream
-    unsigned int frameCount;    // Total number of frames (considering channels)
-} Sound;
-
-// Music, audio stream, anything longer than ~10 seconds should be streamed
-typedef struct Music {
-    AudioStream stream;         // Audio stream
-    unsigned int frameCount;    // Total number of frames (considering channels)
-    bool looping;               // Music looping enable
-
-    int ctxType;                // Type of music context (audio filetype)
-    void *ctxData;              // Audio context data, depends on type
-} Music;
-
-// VrDeviceInfo, Head-Mounted-Display device parameters
-typedef struct VrDeviceInfo {
-    int hResolution;                // Horizontal resolution in pixels
-    int vResolution;                // Vertical resolution in pixels
-    float hScreenSize;              // Horizontal size in meters
-    float vScreenSize;              // Vertical size in meters
-    float eyeToScreenDistance;      // Distance between eye and display in meters
-    float lensSeparationDistance;   // Lens separation distance in meters
-    float interpupillaryDistance;   // IPD (distance between pupils) in meters
-    float lensDistortionValues[4];  // Lens distortion constant parameters
-    float chromaAbCorrection[4];    // Chromatic aberration correction parameters
-} VrDeviceInfo;
-
-// VrStereoConfig, VR stereo rendering configuration for simulator
-typedef struct VrStereoConfig {
-    Matrix projection[2];           // VR projection matrices (per eye)
-    Matrix viewOffset[2];           // VR view offset matrices (per eye)
-    float leftLensCenter[2];        // VR left lens center
-    float rightLensCenter[2];       // VR right lens center
-    float leftScreenCenter[2];      // VR left screen center
-    float rightScreenCenter[2];     // VR right screen center
-    float scale[2];                 // VR distortion scale
-    float scaleIn[2];               // VR distortion scale in
-} VrStereoConfig;
-
-// File path list
-typedef struct FilePathList {
-    unsigned int capacity;          // Filepaths max entries
-    unsigned int count;             // Filepaths entries count
-    char **paths;                   // Filepaths entries
-} FilePathList;
-
-// Automation event
-typedef struct AutomationEvent {
-    unsigned int frame;             // Event frame
-    unsigned int type;              // Event type (AutomationEventType)
-    int params[4];                  // Event parameters (if required)
-} AutomationEvent;
-
-// Automation event list
-typedef struct AutomationEventList {
-    unsigned int capacity;          // Events max entries (MAX_AUTOMATION_EVENTS)
-    unsigned int count;             // Events entries count
-    AutomationEvent *events;        // Events entries
-} AutomationEventList;
-
-//----------------------------------------------------------------------------------
-// Enumerators Definition
-//----------------------------------------------------------------------------------
-// System/Window config flags
-// NOTE: Every bit registers one state (use it with bit masks)
-// By default all flags are set to 0
-typedef enum {
-    FLAG_VSYNC_HINT         = 0x00000040,   // Set to try enabling V-Sync on GPU
-    FLAG_FULLSCREEN_MODE    = 0x00000002,   // Set to run program in fullscreen
-    FLAG_WINDOW_RESIZABLE   = 0x00000004,   // Set to allow resizable window
-    FLAG_WINDOW_UNDECORATED = 0x00000008,   // Set to disable window decoration (frame and buttons)
-    FLAG_WINDOW_HIDDEN      = 0x00000080,   // Set to hide window
-    FLAG_WINDOW_MINIMIZED   = 0x00000200,   // Set to minimize window (iconify)
-    FLAG_WINDOW_MAXIMIZED   = 0x00000400,   // Set to maximize window (expanded to monitor)
-    FLAG_WINDOW_UNFOCUSED   = 0x00000800,   // Set to window non focused
-    FLAG_WINDOW_TOPMOST     = 0x00001000,   // Set to window always on top
-    FLAG_WINDOW_ALWAYS_RUN  = 0x00000100,   // Set to allow windows running while minimized
-    FLAG_WINDOW_TRANSPARENT = 0x00000010,   // Set to allow transparent framebuffer
-    FLAG_WINDOW_HIGHDPI     = 0x00002000,   // Set to support HighDPI
-    FLAG_WINDOW_MOUSE_PASSTHROUGH = 0x00004000, // Set to support mouse passthrough, only supported when FLAG_WINDOW_UNDECORATED
-    FLAG_BORDERLESS_WINDOWED_MODE = 0x00008000, // Set to run program in borderless windowed mode
-    FLAG_MSAA_4X_HINT       = 0x00000020,   // Set to try enabling MSAA 4X
-    FLAG_INTERLACED_HINT    = 0x00010000    // Set to try enabling interlaced video format (for V3D)
-} ConfigFlags;
-
-// Trace log level
-// NOTE: Organized by priority level
-typedef enum {
-    LOG_ALL = 0,        // Display all logs
-    LOG_TRACE,          // Trace logging, intended for internal use only
-    LOG_DEBUG,          // Debug logging, used for internal debugging, it should be disabled on release builds
-    LOG_INFO,           // Info logging, used for program execution info
-    LOG_WARNING,        // Warning logging, used on recoverable failures
-    LOG_ERROR,          // Error logging, used on unrecoverable failures
-    LOG_FATAL,          // Fatal logging, used to abort program: exit(EXIT_FAILURE)
-    LOG_NONE            // Disable logging
-} TraceLogLevel;
-
-// Keyboard keys (US keyboard layout)
-// NOTE: Use GetKeyPressed() to allow redefining
-// required keys for alternative layouts
-typedef enum {
-    KEY_NULL            = 0,        // Key: NULL, used for no key pressed
-    // Alphanumeric keys
-    KEY_APOSTROPHE      = 39,       // Key: '
-    KEY_COMMA           = 44,       // Key: ,
-    KEY_MINUS           = 45,       // Key: -
-    KEY_PERIOD          = 46,       // Key: .
-    KEY_SLASH           = 47,       // Key: /
-    KEY_ZERO            = 48,       // Key: 0
-    KEY_ONE             = 49,       // Key: 1
-    KEY_TWO             = 50,       // Key: 2
-    KEY_THREE           = 51,       // Key: 3
-    KEY_FOUR            = 52,       // Key: 4
-    KEY_FIVE            = 53,       // Key: 5
-    KEY_SIX             = 54,       // Key: 6
-    KEY_SEVEN           = 55,       // Key: 7
-    KEY_EIGHT           = 56,       // Key: 8
-    KEY_NINE            = 57,       // Key: 9
-    KEY_SEMICOLON       = 59,       // Key: ;
-    KEY_EQUAL           = 61,       // Key: =
-    KEY_A               = 65,       // Key: A | a
-    KEY_B               = 66,       // Key: B | b
-    KEY_C               = 67,       // Key: C | c
-    KEY_D               = 68,       // Key: D | d
-    KEY_E               = 69,       // Key: E | e
-    KEY_F               = 70,       // Key: F | f
-    KEY_G               = 71,       // Key: G | g
-    KEY_H               = 72,       // Key: H | h
-    KEY_I               = 73,       // Key: I | i
-    KEY_J               = 74,       // Key: J | j
-    KEY_K               = 75,       // Key: K | k
-    KEY_L               = 76,       // Key: L | l
-    KEY_M               = 77,       // Key: M | m
-    KEY_N               = 78,       // Key: N | n
-    KEY_O               = 79,       // Key: O | o
-    KEY_P               = 80,       // Key: P | p
-    KEY_Q               = 81,       // Key: Q | q
-    KEY_R               = 82,       // Key: R | r
-    KEY_S               = 83,       // Key: S | s
-    KEY_T               = 84,       // Key: T | t
-    KEY_U               = 85,       // Key: U | u
-    KEY_V               = 86,       // Key: V | v
-    KEY_W               = 87,       // Key: W | w
-    KEY_X               = 88,       // Key: X | x
-    KEY_Y               = 89,       // Key: Y | y
-    KEY_Z               = 90,       // Key: Z | z
-    KEY_LEFT_BRACKET    = 91,       // Key: [
-    KEY_BACKSLASH       = 92,       // Key: '\'
-    KEY_RIGHT_BRACKET   = 93,       // Key: ]
-    KEY_GRAVE           = 96,       // Key: `
-    // Function keys
-    KEY_SPACE           = 32,       // Key: Space
-    KEY_ESCAPE          = 256,      // Key: Esc
-    KEY_ENTER           = 257,      // Key: Enter
-    KEY_TAB             = 258,      // Key: Tab
-    KEY_BACKSPACE       = 259,      // Key: Backspace
-    KEY_INSERT          = 260,      // Key: Ins
-    KEY_DELETE          = 261,      // Key: Del
-    KEY_RIGHT           = 262,      // Key: Cursor right
-    KEY_LEFT            = 263,      // Key: Cursor left
-    KEY_DOWN            = 264,      // Key: Cursor down
-    KEY_UP              = 265,      // Key: Cursor up
-    KEY_PAGE_UP         = 266,      // Key: Page up
-    KEY_PAGE_DOWN       = 267,      // Key: Page down
-    KEY_HOME            = 268,      // Key: Home
-    KEY_END             = 269,      // Key: End
-    KEY_CAPS_LOCK       = 280,      // Key: Caps lock
-    KEY_SCROLL_LOCK     = 281,      // Key: Scroll down
-    KEY_NUM_LOCK        = 282,      // Key: Num lock
-    KEY_PRINT_SCREEN    = 283,      // Key: Print screen
-    KEY_PAUSE           = 284,      // Key: Pause
-    KEY_F1              = 290,      // Key: F1
-    KEY_F2              = 291,      // Key: F2
-    KEY_F3              = 292,      // Key: F3
-    KEY_F4              = 293,      // Key: F4
-    KEY_F5              = 294,      // Key: F5
-    KEY_F6              = 295,      // Key: F6
-    KEY_F7              = 296,      // Key: F7
-    KEY_F8              = 297,      // Key: F8
-    KEY_F9              = 298,      // Key: F9
-    KEY_F10             = 299,      // Key: F10
-    KEY_F11             = 300,      // Key: F11
-    KEY_F12             = 301,      // Key: F12
-    KEY_LEFT_SHIFT      = 340,      // Key: Shift left
-    KEY_LEFT_CONTROL    = 341,      // Key: Control left
-    KEY_LEFT_ALT        = 342,      // Key: Alt left
-    KEY_LEFT_SUPER      = 343,      // Key: Super left
-    KEY_RIGHT_SHIFT     = 344,      // Key: Shift right
-    KEY_RIGHT_CONTROL   = 345,      // Key: Control right
-    KEY_RIGHT_ALT       = 346,      // Key: Alt right
-    KEY_RIGHT_SUPER     = 347,      // Key: Super right
-    KEY_KB_MENU         = 348,      // Key: KB menu
-    // Keypad keys
-    KEY_KP_0            = 320,      // Key: Keypad 0
-    KEY_KP_1            = 321,      // Key: Keypad 1
-    KEY_KP_2            = 322,      // Key: Keypad 2
-    KEY_KP_3            = 323,      // Key: Keypad 3
-    KEY_KP_4            = 324,      // Key: Keypad 4
-    KEY_KP_5            = 325,      // Key: Keypad 5
-    KEY_KP_6            = 326,      // Key: Keypad 6
-    KEY_KP_7            = 327,      // Key: Keypad 7
-    KEY_KP_8            = 328,      // Key: Keypad 8
-    KEY_KP_9            = 329,      // Key: Keypad 9
-    KEY_KP_DECIMAL      = 330,      // Key: Keypad .
-    KEY_KP_DIVIDE       = 331,      // Key: Keypad /
-    KEY_KP_MULTIPLY     = 332,      // Key: Keypad *
-    KEY_KP_SUBTRACT     = 333,      // Key: Keypad -
-    KEY_KP_ADD          = 334,      // Key: Keypad +
-    KEY_KP_ENTER        = 335,      // Key: Keypad Enter
-    KEY_KP_EQUAL        = 336,      // Key: Keypad =
-    // Android key buttons
-    KEY_BACK            = 4,        // Key: Android back button
-    KEY_MENU            = 5,        // Key: Android menu button
-    KEY_VOLUME_UP       = 24,       // Key: Android volume up button
-    KEY_VOLUME_DOWN     = 25        // Key: Android volume down button
-} KeyboardKey;
-
-// Add backwards compatibility support for deprecated names
-#define MOUSE_LEFT_BUTTON   MOUSE_BUTTON_LEFT
-#define MOUSE_RIGHT_BUTTON  MOUSE_BUTTON_RIGHT
-#define MOUSE_MIDDLE_BUTTON MOUSE_BUTTON_MIDDLE
-
-// Mouse buttons
-typedef enum {
-    MOUSE_BUTTON_LEFT    = 0,       // Mouse button left
-    MOUSE_BUTTON_RIGHT   = 1,       // Mouse button right
-    MOUSE_BUTTON_MIDDLE  = 2,       // Mouse button middle (pressed wheel)
-    MOUSE_BUTTON_SIDE    = 3,       // Mouse button side (advanced mouse device)
-    MOUSE_BUTTON_EXTRA   = 4,       // Mouse button extra (advanced mouse device)
-    MOUSE_BUTTON_FORWARD = 5,       // Mouse button forward (advanced mouse device)
-    MOUSE_BUTTON_BACK    = 6,       // Mouse button back (advanced mouse device)
-} MouseButton;
-
-// Mouse cursor
-typedef enum {
-    MOUSE_CURSOR_DEFAULT       = 0,     // Default pointer shape
-    MOUSE_CURSOR_ARROW         = 1,     // Arrow shape
-    MOUSE_CURSOR_IBEAM         = 2,     // Text writing cursor shape
-    MOUSE_CURSOR_CROSSHAIR     = 3,     // Cross shape
-    MOUSE_CURSOR_POINTING_HAND = 4,     // Pointing hand cursor
-    MOUSE_CURSOR_RESIZE_EW     = 5,     // Horizontal resize/move arrow shape
-    MOUSE_CURSOR_RESIZE_NS     = 6,     // Vertical resize/move arrow shape
-    MOUSE_CURSOR_RESIZE_NWSE   = 7,     // Top-left to bottom-right diagonal resize/move arrow shape
-    MOUSE_CURSOR_RESIZE_NESW   = 8,     // The top-right to bottom-left diagonal resize/move arrow shape
-    MOUSE_CURSOR_RESIZE_ALL    = 9,     // The omnidirectional resize/move cursor shape
-    MOUSE_CURSOR_NOT_ALLOWED   = 10     // The operation-not-allowed shape
-} MouseCursor;
-
-// Gamepad buttons
-typedef enum {
-    GAMEPAD_BUTTON_UNKNOWN = 0,         // Unknown button, just for error checking
-    GAMEPAD_BUTTON_LEFT_FACE_UP,        // Gamepad left DPAD up button
-    GAMEPAD_BUTTON_LEFT_FACE_RIGHT,     // Gamepad left DPAD right button
-    GAMEPAD_BUTTON_LEFT_FACE_DOWN,      // Gamepad left DPAD down button
-    GAMEPAD_BUTTON_LEFT_FACE_LEFT,      // Gamepad left DPAD left button
-    GAMEPAD_BUTTON_RIGHT_FACE_UP,       // Gamepad right button up (i.e. PS3: Triangle, Xbox: Y)
-    GAMEPAD_BUTTON_RIGHT_FACE_RIGHT,    // Gamepad right button right (i.e. PS3: Circle, Xbox: B)
-    GAMEPAD_BUTTON_RIGHT_FACE_DOWN,     // Gamepad right button down (i.e. PS3: Cross, Xbox: A)
-    GAMEPAD_BUTTON_RIGHT_FACE_LEFT,     // Gamepad right button left (i.e. PS3: Square, Xbox: X)
-    GAMEPAD_BUTTON_LEFT_TRIGGER_1,      // Gamepad top/back trigger left (first), it could be a trailing button
-    GAMEPAD_BUTTON_LEFT_TRIGGER_2,      // Gamepad top/back trigger left (second), it could be a trailing button
-    GAMEPAD_BUTTON_RIGHT_TRIGGER_1,     // Gamepad top/back trigger right (first), it could be a trailing button
-    GAMEPAD_BUTTON_RIGHT_TRIGGER_2,     // Gamepad top/back trigger right (second), it could be a trailing button
-    GAMEPAD_BUTTON_MIDDLE_LEFT,         // Gamepad center buttons, left one (i.e. PS3: Select)
-    GAMEPAD_BUTTON_MIDDLE,              // Gamepad center buttons, middle one (i.e. PS3: PS, Xbox: XBOX)
-    GAMEPAD_BUTTON_MIDDLE_RIGHT,        // Gamepad center buttons, right one (i.e. PS3: Start)
-    GAMEPAD_BUTTON_LEFT_THUMB,          // Gamepad joystick pressed button left
-    GAMEPAD_BUTTON_RIGHT_THUMB          // Gamepad joystick pressed button right
-} GamepadButton;
-
-// Gamepad axis
-typedef enum {
-    GAMEPAD_AXIS_LEFT_X        = 0,     // Gamepad left stick X axis
-    GAMEPAD_AXIS_LEFT_Y        = 1,     // Gamepad left stick Y axis
-    GAMEPAD_AXIS_RIGHT_X       = 2,     // Gamepad right stick X axis
-    GAMEPAD_AXIS_RIGHT_Y       = 3,     // Gamepad right stick Y axis
-    GAMEPAD_AXIS_LEFT_TRIGGER  = 4,     // Gamepad back trigger left, pressure level: [1..-1]
-    GAMEPAD_AXIS_RIGHT_TRIGGER = 5      // Gamepad back trigger right, pressure level: [1..-1]
-} GamepadAxis;
-
-// Material map index
-typedef enum {
-    MATERIAL_MAP_ALBEDO = 0,        // Albedo material (same as: MATERIAL_MAP_DIFFUSE)
-    MATERIAL_MAP_METALNESS,         // Metalness material (same as: MATERIAL_MAP_SPECULAR)
-    MATERIAL_MAP_NORMAL,            // Normal material
-    MATERIAL_MAP_ROUGHNESS,         // Roughness material
-    MATERIAL_MAP_OCCLUSION,         // Ambient occlusion material
-    MATERIAL_MAP_EMISSION,          // Emission material
-    MATERIAL_MAP_HEIGHT,            // Heightmap material
-    MATERIAL_MAP_CUBEMAP,           // Cubemap material (NOTE: Uses GL_TEXTURE_CUBE_MAP)
-    MATERIAL_MAP_IRRADIANCE,        // Irradiance material (NOTE: Uses GL_TEXTURE_CUBE_MAP)
-    MATERIAL_MAP_PREFILTER,         // Prefilter material (NOTE: Uses GL_TEXTURE_CUBE_MAP)
-    MATERIAL_MAP_BRDF               // Brdf material
-} MaterialMapIndex;
-
-#define MATERIAL_MAP_DIFFUSE      MATERIAL_MAP_ALBEDO
-#define MATERIAL_MAP_SPECULAR     MATERIAL_MAP_METALNESS
-
-// Shader location index
-typedef enum {
-    SHADER_LOC_VERTEX_POSITION = 0, // Shader location: vertex attribute: position
-    SHADER_LOC_VERTEX_TEXCOORD01,   // Shader location: vertex attribute: texcoord01
-    SHADER_LOC_VERTEX_TEXCOORD02,   // Shader location: vertex attribute: texcoord02
-    SHADER_LOC_VERTEX_NORMAL,       // Shader location: vertex attribute: normal
-    SHADER_LOC_VERTEX_TANGENT,      // Shader location: vertex attribute: tangent
-    SHADER_LOC_VERTEX_COLOR,        // Shader location: vertex attribute: color
-    SHADER_LOC_MATRIX_MVP,          // Shader location: matrix uniform: model-view-projection
-    SHADER_LOC_MATRIX_VIEW,         // Shader location: matrix uniform: view (camera transform)
-    SHADER_LOC_MATRIX_PROJECTION,   // Shader location: matrix uniform: projection
-    SHADER_LOC_MATRIX_MODEL,        // Shader location: matrix uniform: model (transform)
-    SHADER_LOC_MATRIX_NORMAL,       // Shader location: matrix uniform: normal
-    SHADER_LOC_VECTOR_VIEW,         // Shader location: vector uniform: view
-    SHADER_LOC_COLOR_DIFFUSE,       // Shader location: vector uniform: diffuse color
-    SHADER_LOC_COLOR_SPECULAR,      // Shader location: vector uniform: specular color
-    SHADER_LOC_COLOR_AMBIENT,       // Shader location: vector uniform: ambient color
-    SHADER_LOC_MAP_ALBEDO,          // Shader location: sampler2d texture: albedo (same as: SHADER_LOC_MAP_DIFFUSE)
-    SHADER_LOC_MAP_METALNESS,       // Shader location: sampler2d texture: metalness (same as: SHADER_LOC_MAP_SPECULAR)
-    SHADER_LOC_MAP_NORMAL,          // Shader location: sampler2d texture: normal
-    SHADER_LOC_MAP_ROUGHNESS,       // Shader location: sampler2d texture: roughness
-    SHADER_LOC_MAP_OCCLUSION,       // Shader location: sampler2d texture: occlusion
-    SHADER_LOC_MAP_EMISSION,        // Shader location: sampler2d texture: emission
-    SHADER_LOC_MAP_HEIGHT,          // Shader location: sampler2d texture: height
-    SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
-    SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
-    SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
-    SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: boneIds
-    SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: boneWeights
-    SHADER_LOC_BONE_MATRICES        // Shader location: array of matrices uniform: boneMatrices
-} ShaderLocationIndex;
-
-#define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
-#define SHADER_LOC_MAP_SPECULAR     SHADER_LOC_MAP_METALNESS
-
-// Shader uniform data type
-typedef enum {
-    SHADER_UNIFORM_FLOAT = 0,       // Shader uniform type: float
-    SHADER_UNIFORM_VEC2,            // Shader uniform type: vec2 (2 float)
-    SHADER_UNIFORM_VEC3,            // Shader uniform type: vec3 (3 float)
-    SHADER_UNIFORM_VEC4,            // Shader uniform type: vec4 (4 float)
-    SHADER_UNIFORM_INT,             // Shader uniform type: int
-    SHADER_UNIFORM_IVEC2,           // Shader uniform type: ivec2 (2 int)
-    SHADER_UNIFORM_IVEC3,           // Shader uniform type: ivec3 (3 int)
-    SHADER_UNIFORM_IVEC4,           // Shader uniform type: ivec4 (4 int)
-    SHADER_UNIFORM_SAMPLER2D        // Shader uniform type: sampler2d
-} ShaderUniformDataType;
-
-// Shader attribute data types
-typedef enum {
-    SHADER_ATTRIB_FLOAT = 0,        // Shader attribute type: float
-    SHADER_ATTRIB_VEC2,             // Shader attribute type: vec2 (2 float)
-    SHADER_ATTRIB_VEC3,             // Shader attribute type: vec3 (3 float)
-    SHADER_ATTRIB_VEC4              // Shader attribute type: vec4 (4 float)
-} ShaderAttributeDataType;
-
-// Pixel formats
-// NOTE: Support depends on OpenGL version and platform
-typedef enum {
-    PIXELFORMAT_UNCOMPRESSED_GRAYSCALE = 1, // 8 bit per pixel (no alpha)
-    PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA,    // 8*2 bpp (2 channels)
-    PIXELFORMAT_UNCOMPRESSED_R5G6B5,        // 16 bpp
-    PIXELFORMAT_UNCOMPRESSED_R8G8B8,        // 24 bpp
-    PIXELFORMAT_UNCOMPRESSED_R5G5B5A1,      // 16 bpp (1 bit alpha)
-    PIXELFORMAT_UNCOMPRESSED_R4G4B4A4,      // 16 bpp (4 bit alpha)
-    PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,      // 32 bpp
-    PIXELFORMAT_UNCOMPRESSED_R32,           // 32 bpp (1 channel - float)
-    PIXELFORMAT_UNCOMPRESSED_R32G32B32,     // 32*3 bpp (3 channels - float)
-    PIXELFORMAT_UNCOMPRESSED_R32G32B32A32,  // 32*4 bpp (4 channels - float)
-    PIXELFORMAT_UNCOMPRESSED_R16,           // 16 bpp (1 channel - half float)
-    PIXELFORMAT_UNCOMPRESSED_R16G16B16,     // 16*3 bpp (3 channels - half float)
-    PIXELFORMAT_UNCOMPRESSED_R16G16B16A16,  // 16*4 bpp (4 channels - half float)
-    PIXELFORMAT_COMPRESSED_DXT1_RGB,        // 4 bpp (no alpha)
-    PIXELFORMAT_COMPRESSED_DXT1_RGBA,       // 4 bpp (1 bit alpha)
-    PIXELFORMAT_COMPRESSED_DXT3_RGBA,       // 8 bpp
-    PIXELFORMAT_COMPRESSED_DXT5_RGBA,       // 8 bpp
-    PIXELFORMAT_COMPRESSED_ETC1_RGB,        // 4 bpp
-    PIXELFORMAT_COMPRESSED_ETC2_RGB,        // 4 bpp
-    PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA,   // 8 bpp
-    PIXELFORMAT_COMPRESSED_PVRT_RGB,        // 4 bpp
-    PIXELFORMAT_COMPRESSED_PVRT_RGBA,       // 4 bpp
-    PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA,   // 8 bpp
-    PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA    // 2 bpp
-} PixelFormat;
-
-// Texture parameters: filter mode
-// NOTE 1: Filtering considers mipmaps if available in the texture
-// NOTE 2: Filter is accordingly set for minification and magnification
-typedef enum {
-    TEXTURE_FILTER_POINT = 0,               // No filter, just pixel approximation
-    TEXTURE_FILTER_BILINEAR,                // Linear filtering
-    TEXTURE_FILTER_TRILINEAR,               // Trilinear filtering (linear with mipmaps)
-    TEXTURE_FILTER_ANISOTROPIC_4X,          // Anisotropic filtering 4x
-    TEXTURE_FILTER_ANISOTROPIC_8X,          // Anisotropic filtering 8x
-    TEXTURE_FILTER_ANISOTROPIC_16X,         // Anisotropic filtering 16x
-} TextureFilter;
-
-// Texture parameters: wrap mode
-typedef enum {
-    TEXTURE_WRAP_REPEAT = 0,                // Repeats texture in tiled mode
-    TEXTURE_WRAP_CLAMP,                     // Clamps texture to edge pixel in tiled mode
-    TEXTURE_WRAP_MIRROR_REPEAT,             // Mirrors and repeats the texture in tiled mode
-    TEXTURE_WRAP_MIRROR_CLAMP               // Mirrors and clamps to border the texture in tiled mode
-} TextureWrap;
-
-// Cubemap layouts
-typedef enum {
-    CUBEMAP_LAYOUT_AUTO_DETECT = 0,         // Automatically detect layout type
-    CUBEMAP_LAYOUT_LINE_VERTICAL,           // Layout is defined by a vertical line with faces
-    CUBEMAP_LAYOUT_LINE_HORIZONTAL,         // Layout is defined by a horizontal line with faces
-    CUBEMAP_LAYOUT_CROSS_THREE_BY_FOUR,     // Layout is defined by a 3x4 cross with cubemap faces
-    CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE     // Layout is defined by a 4x3 cross with cubemap faces
-} CubemapLayout;
-
-// Font type, defines generation method
-typedef enum {
-    FONT_DEFAULT = 0,               // Default font generation, anti-aliased
-    FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
-} FontType;
-
-// Color blending modes (pre-defined)
-typedef enum {
-    BLEND_ALPHA = 0,                // Blend textures considering alpha (default)
-    BLEND_ADDITIVE,                 // Blend textures adding colors
-    BLEND_MULTIPLIED,               // Blend textures multiplying colors
-    BLEND_ADD_COLORS,               // Blend textures adding colors (alternative)
-    BLEND_SUBTRACT_COLORS,          // Blend textures subtracting colors (alternative)
-    BLEND_ALPHA_PREMULTIPLY,        // Blend premultiplied textures considering alpha
-    BLEND_CUSTOM,                   // Blend textures using custom src/dst factors (use rlSetBlendFactors())
-    BLEND_CUSTOM_SEPARATE           // Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())
-} BlendMode;
-
-// Gesture
-// NOTE: Provided as bit-wise flags to enable only desired gestures
-typedef enum {
-    GESTURE_NONE        = 0,        // No gesture
-    GESTURE_TAP         = 1,        // Tap gesture
-    GESTURE_DOUBLETAP   = 2,        // Double tap gesture
-    GESTURE_HOLD        = 4,        // Hold gesture
-    GESTURE_DRAG        = 8,        // Drag gesture
-    GESTURE_SWIPE_RIGHT = 16,       // Swipe right gesture
-    GESTURE_SWIPE_LEFT  = 32,       // Swipe left gesture
-    GESTURE_SWIPE_UP    = 64,       // Swipe up gesture
-    GESTURE_SWIPE_DOWN  = 128,      // Swipe down gesture
-    GESTURE_PINCH_IN    = 256,      // Pinch in gesture
-    GESTURE_PINCH_OUT   = 512       // Pinch out gesture
-} Gesture;
-
-// Camera system modes
-typedef enum {
-    CAMERA_CUSTOM = 0,              // Camera custom, controlled by user (UpdateCamera() does nothing)
-    CAMERA_FREE,                    // Camera free mode
-    CAMERA_ORBITAL,                 // Camera orbital, around target, zoom supported
-    CAMERA_FIRST_PERSON,            // Camera first person
-    CAMERA_THIRD_PERSON             // Camera third person
-} CameraMode;
-
-// Camera projection
-typedef enum {
-    CAMERA_PERSPECTIVE = 0,         // Perspective projection
-    CAMERA_ORTHOGRAPHIC             // Orthographic projection
-} CameraProjection;
-
-// N-patch layout
-typedef enum {
-    NPATCH_NINE_PATCH = 0,          // Npatch layout: 3x3 tiles
-    NPATCH_THREE_PATCH_VERTICAL,    // Npatch layout: 1x3 tiles
-    NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
-} NPatchLayout;
-
-typedef char *va_list;
-// Callbacks to hook some internal functions
-// WARNING: These callbacks are intended for advanced users
-typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
-typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSize);    // FileIO: Load binary data
-typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
-typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
-typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
-
-//------------------------------------------------------------------------------------
-// Global Variables Definition
-//------------------------------------------------------------------------------------
-// It's lonely here...
-
-//------------------------------------------------------------------------------------
-// Window and Graphics Device Functions (Module: core)
-//------------------------------------------------------------------------------------
-
-// Window-related functions
-void InitWindow(int width, int height, const char *title);  // Initialize window and OpenGL context
-void CloseWindow(void);                                     // Close window and unload OpenGL context
-bool WindowShouldClose(void);                               // Check if application should close (KEY_ESCAPE pressed or windows close icon clicked)
-bool IsWindowReady(void);                                   // Check if window has been initialized successfully
-bool IsWindowFullscreen(void);                              // Check if window is currently fullscreen
-bool IsWindowHidden(void);                                  // Check if window is currently hidden
-bool IsWindowMinimized(void);                               // Check if window is currently minimized
-bool IsWindowMaximized(void);                               // Check if window is currently maximized
-bool IsWindowFocused(void);                                 // Check if window is currently focused
-bool IsWindowResized(void);                                 // Check if window has been resized last frame
-bool IsWindowState(unsigned int flag);                      // Check if one specific window flag is enabled
-void SetWindowState(unsigned int flags);                    // Set window configuration state using flags
-void ClearWindowState(unsigned int flags);                  // Clear window configuration state flags
-void ToggleFullscreen(void);                                // Toggle window state: fullscreen/windowed, resizes monitor to match window resolution
-void ToggleBorderlessWindowed(void);                        // Toggle window state: borderless windowed, resizes window to match monitor resolution
-void MaximizeWindow(void);                                  // Set window state: maximized, if resizable
-void MinimizeWindow(void);                                  // Set window state: minimized, if resizable
-void RestoreWindow(void);                                   // Set window state: not minimized/maximized
-void SetWindowIcon(Image image);                            // Set icon for window (single image, RGBA 32bit)
-void SetWindowIcons(Image *images, int count);              // Set icon for window (multiple images, RGBA 32bit)
-void SetWindowTitle(const char *title);                     // Set title for window
-void SetWindowPosition(int x, int y);                       // Set window position on screen
-void SetWindowMonitor(int monitor);                         // Set monitor for the current window
-void SetWindowMinSize(int width, int height);               // Set window minimum dimensions (for FLAG_WINDOW_RESIZABLE)
-void SetWindowMaxSize(int width, int height);               // Set window maximum dimensions (for FLAG_WINDOW_RESIZABLE)
-void SetWindowSize(int width, int height);                  // Set window dimensions
-void SetWindowOpacity(float opacity);                       // Set window opacity [0.0f..1.0f]
-void SetWindowFocused(void);                                // Set window focused
-void *GetWindowHandle(void);                                // Get native window handle
-int GetScreenWidth(void);                                   // Get current screen width
-int GetScreenHeight(void);                                  // Get current screen height
-int GetRenderWidth(void);                                   // Get current render width (it considers HiDPI)
-int GetRenderHeight(void);                                  // Get current render height (it considers HiDPI)
-int GetMonitorCount(void);                                  // Get number of connected monitors
-int GetCurrentMonitor(void);                                // Get current monitor where window is placed
-Vector2 GetMonitorPosition(int monitor);                    // Get specified monitor position
-int GetMonitorWidth(int monitor);                           // Get specified monitor width (current video mode used by monitor)
-int GetMonitorHeight(int monitor);                          // Get specified monitor height (current video mode used by monitor)
-int GetMonitorPhysicalWidth(int monitor);                   // Get specified monitor physical width in millimetres
-int GetMonitorPhysicalHeight(int monitor);                  // Get specified monitor physical height in millimetres
-int GetMonitorRefreshRate(int monitor);                     // Get specified monitor refresh rate
-Vector2 GetWindowPosition(void);                            // Get window position XY on monitor
-Vector2 GetWindowScaleDPI(void);                            // Get window scale DPI factor
-const char *GetMonitorName(int monitor);                    // Get the human-readable, UTF-8 encoded name of the specified monitor
-void SetClipboardText(const char *text);                    // Set clipboard text content
-const char *GetClipboardText(void);                         // Get clipboard text content
-Image GetClipboardImage(void);                              // Get clipboard image content
-void EnableEventWaiting(void);                              // Enable waiting for events on EndDrawing(), no automatic event polling
-void DisableEventWaiting(void);                             // Disable waiting for events on EndDrawing(), automatic events polling
-
-// Cursor-related functions
-void ShowCursor(void);                                      // Shows cursor
-void HideCursor(void);                                      // Hides cursor
-bool IsCursorHidden(void);                                  // Check if cursor is not visible
-void EnableCursor(void);                                    // Enables cursor (unlock cursor)
-void DisableCursor(void);                                   // Disables cursor (lock cursor)
-bool IsCursorOnScreen(void);                                // Check if cursor is on the screen
-
-// Drawing-related functions
-void ClearBackground(Color color);                          // Set background color (framebuffer clear color)
-void BeginDrawing(void);                                    // Setup canvas (framebuffer) to start drawing
-void EndDrawing(void);                                      // End canvas drawing and swap buffers (double buffering)
-void BeginMode2D(Camera2D camera);                          // Begin 2D mode with custom camera (2D)
-void EndMode2D(void);                                       // Ends 2D mode with custom camera
-void BeginMode3D(Camera3D camera);                          // Begin 3D mode with custom camera (3D)
-void EndMode3D(void);                                       // Ends 3D mode and returns to default 2D orthographic mode
-void BeginTextureMode(RenderTexture2D target);              // Begin drawing to render texture
-void EndTextureMode(void);                                  // Ends drawing to render texture
-void BeginShaderMode(Shader shader);                        // Begin custom shader drawing
-void EndShaderMode(void);                                   // End custom shader drawing (use default shader)
-void BeginBlendMode(int mode);                              // Begin blending mode (alpha, additive, multiplied, subtract, custom)
-void EndBlendMode(void);                                    // End blending mode (reset to default: alpha blending)
-void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
-void EndScissorMode(void);                                  // End scissor mode
-void BeginVrStereoMode(VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
-void EndVrStereoMode(void);                                 // End stereo rendering (requires VR simulator)
-
-// VR stereo config functions for VR simulator
-VrStereoConfig LoadVrStereoConfig(VrDeviceInfo device);     // Load VR stereo config for VR simulator device parameters
-void UnloadVrStereoConfig(VrStereoConfig config);           // Unload VR stereo config
-
-// Shader management functions
-// NOTE: Shader functionality is not available on OpenGL 1.1
-Shader LoadShader(const char *vsFileName, const char *fsFileName);   // Load shader from files and bind default locations
-Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode); // Load shader from code strings and bind default locations
-bool IsShaderValid(Shader shader);                                   // Check if a shader is valid (loaded on GPU)
-int GetShaderLocation(Shader shader, const char *uniformName);       // Get shader uniform location
-int GetShaderLocationAttrib(Shader shader, const char *attribName);  // Get shader attribute location
-void SetShaderValue(Shader shader, int locIndex, const void *value, int uniformType);               // Set shader uniform value
-void SetShaderValueV(Shader shader, int locIndex, const void *value, int uniformType, int count);   // Set shader uniform value vector
-void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat);         // Set shader uniform value (matrix 4x4)
-void SetShaderValueTexture(Shader shader, int locIndex, Texture2D texture); // Set shader uniform value for texture (sampler2d)
-void UnloadShader(Shader shader);                                    // Unload shader from GPU memory (VRAM)
-
-// Screen-space-related functions
-#define GetMouseRay GetScreenToWorldRay     // Compatibility hack for previous raylib versions
-Ray GetScreenToWorldRay(Vector2 position, Camera camera);         // Get a ray trace from screen position (i.e mouse)
-Ray GetScreenToWorldRayEx(Vector2 position, Camera camera, int width, int height); // Get a ray trace from screen position (i.e mouse) in a viewport
-Vector2 GetWorldToScreen(Vector3 position, Camera camera);        // Get the screen space position for a 3d world space position
-Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int height); // Get size position for a 3d world space position
-Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera);    // Get the screen space position for a 2d camera world space position
-Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera);    // Get the world space position for a 2d camera screen space position
-Matrix GetCameraMatrix(Camera camera);                            // Get camera transform matrix (view matrix)
-Matrix GetCameraMatrix2D(Camera2D camera);                        // Get camera 2d transform matrix
-
-// Timing-related functions
-void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
-float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
-double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
-int GetFPS(void);                                           // Get current FPS
-
-// Custom frame control functions
-// NOTE: Those functions are intended for advanced users that want full control over the frame processing
-// By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
-// To avoid that behaviour and control frame processes manually, enable in config.h: SUPPORT_CUSTOM_FRAME_CONTROL
-void SwapScreenBuffer(void);                                // Swap back buffer with front buffer (screen drawing)
-void PollInputEvents(void);                                 // Register all input events
-void WaitTime(double seconds);                              // Wait for some time (halt program execution)
-
-// Random values generation functions
-void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator
-int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included)
-int *LoadRandomSequence(unsigned int count, int min, int max); // Load random values sequence, no values repeated
-void UnloadRandomSequence(int *sequence);                   // Unload random values sequence
-
-// Misc. functions
-void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
-void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
-void OpenURL(const char *url);                              // Open URL with default system browser (if available)
-
-// NOTE: Following functions implemented in module [utils]
-//------------------------------------------------------------------
-void TraceLog(int logLevel, const char *text, ...);         // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
-void SetTraceLogLevel(int logLevel);                        // Set the current threshold (minimum) log level
-void *MemAlloc(unsigned int size);                          // Internal memory allocator
-void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
-void MemFree(void *ptr);                                    // Internal memory free
-
-// Set custom callbacks
-// WARNING: Callbacks setup is intended for advanced users
-void SetTraceLogCallback(TraceLogCallback callback);         // Set custom trace log
-void SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom file binary data loader
-void SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
-void SetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
-void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
-
-// Files management functions
-unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
-void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
-bool SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
-bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
-char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
-void UnloadFileText(char *text);                            // Unload file text data allocated by LoadFileText()
-bool SaveFileText(const char *fileName, char *text);        // Save text data to file (write), string must be '\0' terminated, returns true on success
-//------------------------------------------------------------------
-
-// File system functions
-bool FileExists(const char *fileName);                      // Check if file exists
-bool DirectoryExists(const char *dirPath);                  // Check if a directory path exists
-bool IsFileExtension(const char *fileName, const char *ext); // Check file extension (including point: .png, .wav)
-int GetFileLength(const char *fileName);                    // Get file length in bytes (NOTE: GetFileSize() conflicts with windows.h)
-const char *GetFileExtension(const char *fileName);         // Get pointer to extension for a filename string (includes dot: '.png')
-const char *GetFileName(const char *filePath);              // Get pointer to filename for a path string
-const char *GetFileNameWithoutExt(const char *filePath);    // Get filename string without extension (uses static string)
-const char *GetDirectoryPath(const char *filePath);         // Get full path for a given fileName with path (uses static string)
-const char *GetPrevDirectoryPath(const char *dirPath);      // Get previous directory path for a given path (uses static string)
-const char *GetWorkingDirectory(void);                      // Get current working directory (uses static string)
-const char *GetApplicationDirectory(void);                  // Get the directory of the running application (uses static string)
-int MakeDirectory(const char *dirPath);                     // Create directories (including full path requested), returns 0 on success
-bool ChangeDirectory(const char *dir);                      // Change working directory, return true on success
-bool IsPathFile(const char *path);                          // Check if a given path is a file or a directory
-bool IsFileNameValid(const char *fileName);                 // Check if fileName is valid for the platform/OS
-FilePathList LoadDirectoryFiles(const char *dirPath);       // Load directory filepaths
-FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs); // Load directory filepaths with extension filtering and recursive directory scan. Use 'DIR' in the filter string to include directories in the result
-void UnloadDirectoryFiles(FilePathList files);              // Unload filepaths
-bool IsFileDropped(void);                                   // Check if a file has been dropped into window
-FilePathList LoadDroppedFiles(void);                        // Load dropped filepaths
-void UnloadDroppedFiles(FilePathList files);                // Unload dropped filepaths
-long GetFileModTime(const char *fileName);                  // Get file modification time (last write time)
-
-// Compression/Encoding functionality
-unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
-unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
-char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
-unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
-unsigned int ComputeCRC32(unsigned char *data, int dataSize);     // Compute CRC32 hash code
-unsigned int *ComputeMD5(unsigned char *data, int dataSize);      // Compute MD5 hash code, returns static int[4] (16 bytes)
-unsigned int *ComputeSHA1(unsigned char *data, int dataSize);      // Compute SHA1 hash code, returns static int[5] (20 bytes)
-
-
-// Automation events functionality
-AutomationEventList LoadAutomationEventList(const char *fileName);                // Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
-void UnloadAutomationEventList(AutomationEventList list);                         // Unload automation events list from file
-bool ExportAutomationEventList(AutomationEventList list, const char *fileName);   // Export automation events list as text file
-void SetAutomationEventList(AutomationEventList *list);                           // Set automation event list to record to
-void SetAutomationEventBaseFrame(int frame);                                      // Set automation event internal base frame to start recording
-void StartAutomationEventRecording(void);                                         // Start recording automation events (AutomationEventList must be set)
-void StopAutomationEventRecording(void);                                          // Stop recording automation events
-void PlayAutomationEvent(AutomationEvent event);                                  // Play a recorded automation event
-
-//------------------------------------------------------------------------------------
-// Input Handling Functions (Module: core)
-//------------------------------------------------------------------------------------
-
-// Input-related functions: keyboard
-bool IsKeyPressed(int key);                             // Check if a key has been pressed once
-bool IsKeyPressedRepeat(int key);                       // Check if a key has been pressed again
-bool IsKeyDown(int key);                                // Check if a key is being pressed
-bool IsKeyReleased(int key);                            // Check if a key has been released once
-bool IsKeyUp(int key);                                  // Check if a key is NOT being pressed
-int GetKeyPressed(void);                                // Get key pressed (keycode), call it multiple times for keys queued, returns 0 when the queue is empty
-int GetCharPressed(void);                               // Get char pressed (unicode), call it multiple times for chars queued, returns 0 when the queue is empty
-void SetExitKey(int key);                               // Set a custom key to exit program (default is ESC)
-
-// Input-related functions: gamepads
-bool IsGamepadAvailable(int gamepad);                                        // Check if a gamepad is available
-const char *GetGamepadName(int gamepad);                                     // Get gamepad internal name id
-bool IsGamepadButtonPressed(int gamepad, int button);                        // Check if a gamepad button has been pressed once
-bool IsGamepadButtonDown(int gamepad, int button);                           // Check if a gamepad button is being pressed
-bool IsGamepadButtonReleased(int gamepad, int button);                       // Check if a gamepad button has been released once
-bool IsGamepadButtonUp(int gamepad, int button);                             // Check if a gamepad button is NOT being pressed
-int GetGamepadButtonPressed(void);                                           // Get the last gamepad button pressed
-int GetGamepadAxisCount(int gamepad);                                        // Get gamepad axis count for a gamepad
-float GetGamepadAxisMovement(int gamepad, int axis);                         // Get axis movement value for a gamepad axis
-int SetGamepadMappings(const char *mappings);                                // Set internal gamepad mappings (SDL_GameControllerDB)
-void SetGamepadVibration(int gamepad, float leftMotor, float rightMotor, float duration); // Set gamepad vibration for both motors (duration in seconds)
-
-// Input-related functions: mouse
-bool IsMouseButtonPressed(int button);                  // Check if a mouse button has been pressed once
-bool IsMouseButtonDown(int button);                     // Check if a mouse button is being pressed
-bool IsMouseButtonReleased(int button);                 // Check if a mouse button has been released once
-bool IsMouseButtonUp(int button);                       // Check if a mouse button is NOT being pressed
-int GetMouseX(void);                                    // Get mouse position X
-int GetMouseY(void);                                    // Get mouse position Y
-Vector2 GetMousePosition(void);                         // Get mouse position XY
-Vector2 GetMouseDelta(void);                            // Get mouse delta between frames
-void SetMousePosition(int x, int y);                    // Set mouse position XY
-void SetMouseOffset(int offsetX, int offsetY);          // Set mouse offset
-void SetMouseScale(float scaleX, float scaleY);         // Set mouse scaling
-float GetMouseWheelMove(void);                          // Get mouse wheel movement for X or Y, whichever is larger
-Vector2 GetMouseWheelMoveV(void);                       // Get mouse wheel movement for both X and Y
-void SetMouseCursor(int cursor);                        // Set mouse cursor
-
-// Input-related functions: touch
-int GetTouchX(void);                                    // Get touch position X for touch point 0 (relative to screen size)
-int GetTouchY(void);                                    // Get touch position Y for touch point 0 (relative to screen size)
-Vector2 GetTouchPosition(int index);                    // Get touch position XY for a touch point index (relative to screen size)
-int GetTouchPointId(int index);                         // Get touch point identifier for given index
-int GetTouchPointCount(void);                           // Get number of touch points
-
-//------------------------------------------------------------------------------------
-// Gestures and Touch Handling Functions (Module: rgestures)
-//------------------------------------------------------------------------------------
-void SetGesturesEnabled(unsigned int flags);      // Enable a set of gestures using flags
-bool IsGestureDetected(unsigned int gesture);     // Check if a gesture have been detected
-int GetGestureDetected(void);                     // Get latest detected gesture
-float GetGestureHoldDuration(void);               // Get gesture hold time in seconds
-Vector2 GetGestureDragVector(void);               // Get gesture drag vector
-float GetGestureDragAngle(void);                  // Get gesture drag angle
-Vector2 GetGesturePinchVector(void);              // Get gesture pinch delta
-float GetGesturePinchAngle(void);                 // Get gesture pinch angle
-
-//------------------------------------------------------------------------------------
-// Camera System Functions (Module: rcamera)
-//------------------------------------------------------------------------------------
-void UpdateCamera(Camera *camera, int mode);      // Update camera position for selected mode
-void UpdateCameraPro(Camera *camera, Vector3 movement, Vector3 rotation, float zoom); // Update camera movement/rotation
-
-//------------------------------------------------------------------------------------
-// Basic Shapes Drawing Functions (Module: shapes)
-//------------------------------------------------------------------------------------
-// Set texture and rectangle to be used on shapes drawing
-// NOTE: It can be useful when using basic shapes and one single font,
-// defining a font char white rectangle would allow drawing everything in a single draw call
-void SetShapesTexture(Texture2D texture, Rectangle source);       // Set texture and rectangle to be used on shapes drawing
-Texture2D GetShapesTexture(void);                                 // Get texture that is used for shapes drawing
-Rectangle GetShapesTextureRectangle(void);                        // Get texture source rectangle that is used for shapes drawing
-
-// Basic shapes drawing functions
-void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel using geometry [Can be slow, use with care]
-void DrawPixelV(Vector2 position, Color color);                                                    // Draw a pixel using geometry (Vector version) [Can be slow, use with care]
-void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color);                // Draw a line
-void DrawLineV(Vector2 startPos, Vector2 endPos, Color color);                                     // Draw a line (using gl lines)
-void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color);                       // Draw a line (using triangles/quads)
-void DrawLineStrip(const Vector2 *points, int pointCount, Color color);                            // Draw lines sequence (using gl lines)
-void DrawLineBezier(Vector2 startPos, Vector2 endPos, float thick, Color color);                   // Draw line segment cubic-bezier in-out interpolation
-void DrawCircle(int centerX, int centerY, float radius, Color color);                              // Draw a color-filled circle
-void DrawCircleSector(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color);      // Draw a piece of a circle
-void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color); // Draw circle sector outline
-void DrawCircleGradient(int centerX, int centerY, float radius, Color inner, Color outer);         // Draw a gradient-filled circle
-void DrawCircleV(Vector2 center, float radius, Color color);                                       // Draw a color-filled circle (Vector version)
-void DrawCircleLines(int centerX, int centerY, float radius, Color color);                         // Draw circle outline
-void DrawCircleLinesV(Vector2 center, float radius, Color color);                                  // Draw circle outline (Vector version)
-void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color);             // Draw ellipse
-void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color);        // Draw ellipse outline
-void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, Color color); // Draw ring
-void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, Color color);    // Draw ring outline
-void DrawRectangle(int posX, int posY, int width, int height, Color color);                        // Draw a color-filled rectangle
-void DrawRectangleV(Vector2 position, Vector2 size, Color color);                                  // Draw a color-filled rectangle (Vector version)
-void DrawRectangleRec(Rectangle rec, Color color);                                                 // Draw a color-filled rectangle
-void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color);                 // Draw a color-filled rectangle with pro parameters
-void DrawRectangleGradientV(int posX, int posY, int width, int height, Color top, Color bottom);   // Draw a vertical-gradient-filled rectangle
-void DrawRectangleGradientH(int posX, int posY, int width, int height, Color left, Color right);   // Draw a horizontal-gradient-filled rectangle
-void DrawRectangleGradientEx(Rectangle rec, Color topLeft, Color bottomLeft, Color topRight, Color bottomRight); // Draw a gradient-filled rectangle with custom vertex colors
-void DrawRectangleLines(int posX, int posY, int width, int height, Color color);                   // Draw rectangle outline
-void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color);                            // Draw rectangle outline with extended parameters
-void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color);              // Draw rectangle with rounded edges
-void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, Color color);         // Draw rectangle lines with rounded edges
-void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color); // Draw rectangle with rounded edges outline
-void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color);                                // Draw a color-filled triangle (vertex in counter-clockwise order!)
-void DrawTriangleLines(Vector2 v1, Vector2 v2, Vector2 v3, Color color);                           // Draw triangle outline (vertex in counter-clockwise order!)
-void DrawTriangleFan(const Vector2 *points, int pointCount, Color color);                          // Draw a triangle fan defined by points (first vertex is the center)
-void DrawTriangleStrip(const Vector2 *points, int pointCount, Color color);                        // Draw a triangle strip defined by points
-void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color);               // Draw a regular polygon (Vector version)
-void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Color color);          // Draw a polygon outline of n sides
-void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color); // Draw a polygon outline of n sides with extended parameters
-
-// Splines drawing functions
-void DrawSplineLinear(const Vector2 *points, int pointCount, float thick, Color color);                  // Draw spline: Linear, minimum 2 points
-void DrawSplineBasis(const Vector2 *points, int pointCount, float thick, Color color);                   // Draw spline: B-Spline, minimum 4 points
-void DrawSplineCatmullRom(const Vector2 *points, int pointCount, float thick, Color color);              // Draw spline: Catmull-Rom, minimum 4 points
-void DrawSplineBezierQuadratic(const Vector2 *points, int pointCount, float thick, Color color);         // Draw spline: Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...]
-void DrawSplineBezierCubic(const Vector2 *points, int pointCount, float thick, Color color);             // Draw spline: Cubic Bezier, minimum 4 points (2 control points): [p1, c2, c3, p4, c5, c6...]
-void DrawSplineSegmentLinear(Vector2 p1, Vector2 p2, float thick, Color color);                    // Draw spline segment: Linear, 2 points
-void DrawSplineSegmentBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color); // Draw spline segment: B-Spline, 4 points
-void DrawSplineSegmentCatmullRom(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color); // Draw spline segment: Catmull-Rom, 4 points
-void DrawSplineSegmentBezierQuadratic(Vector2 p1, Vector2 c2, Vector2 p3, float thick, Color color); // Draw spline segment: Quadratic Bezier, 2 points, 1 control point
-void DrawSplineSegmentBezierCubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float thick, Color color); // Draw spline segment: Cubic Bezier, 2 points, 2 control points
-
-// Spline segment point evaluation functions, for a given t [0.0f .. 1.0f]
-Vector2 GetSplinePointLinear(Vector2 startPos, Vector2 endPos, float t);                           // Get (evaluate) spline point: Linear
-Vector2 GetSplinePointBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t);              // Get (evaluate) spline point: B-Spline
-Vector2 GetSplinePointCatmullRom(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t);         // Get (evaluate) spline point: Catmull-Rom
-Vector2 GetSplinePointBezierQuad(Vector2 p1, Vector2 c2, Vector2 p3, float t);                     // Get (evaluate) spline point: Quadratic Bezier
-Vector2 GetSplinePointBezierCubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float t);        // Get (evaluate) spline point: Cubic Bezier
-
-// Basic shapes collision detection functions
-bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2);                                           // Check collision between two rectangles
-bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2);        // Check collision between two circles
-bool CheckCollisionCircleRec(Vector2 center, float radius, Rectangle rec);                         // Check collision between circle and rectangle
-bool CheckCollisionCircleLine(Vector2 center, float radius, Vector2 p1, Vector2 p2);               // Check if circle collides with a line created betweeen two points [p1] and [p2]
-bool CheckCollisionPointRec(Vector2 point, Rectangle rec);                                         // Check if point is inside rectangle
-bool CheckCollisionPointCircle(Vector2 point, Vector2 center, float radius);                       // Check if point is inside circle
-bool CheckCollisionPointTriangle(Vector2 point, Vector2 p1, Vector2 p2, Vector2 p3);               // Check if point is inside a triangle
-bool CheckCollisionPointLine(Vector2 point, Vector2 p1, Vector2 p2, int threshold);                // Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
-bool CheckCollisionPointPoly(Vector2 point, const Vector2 *points, int pointCount);                // Check if point is within a polygon described by array of vertices
-bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint); // Check the collision between two lines defined by two points each, returns collision point by reference
-Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
-
-//------------------------------------------------------------------------------------
-// Texture Loading and Drawing Functions (Module: textures)
-//------------------------------------------------------------------------------------
-
-// Image loading functions
-// NOTE: These functions do not require GPU access
-Image LoadImage(const char *fileName);                                                             // Load image from file into CPU memory (RAM)
-Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
-Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
-Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
-Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
-Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
-Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
-bool IsImageValid(Image image);                                                                    // Check if an image is valid (data and parameters)
-void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
-bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
-unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
-bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
-
-// Image generation functions
-Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
-Image GenImageGradientLinear(int width, int height, int direction, Color start, Color end);        // Generate image: linear gradient, direction in degrees [0..360], 0=Vertical gradient
-Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer);      // Generate image: radial gradient
-Image GenImageGradientSquare(int width, int height, float density, Color inner, Color outer);      // Generate image: square gradient
-Image GenImageChecked(int width, int height, int checksX, int checksY, Color col1, Color col2);    // Generate image: checked
-Image GenImageWhiteNoise(int width, int height, float factor);                                     // Generate image: white noise
-Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
-Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
-Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
-
-// Image manipulation functions
-Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
-Image ImageFromImage(Image image, Rectangle rec);                                                  // Create an image from another image piece
-Image ImageFromChannel(Image image, int selectedChannel);                                          // Create an image from a selected channel of another image (GRAYSCALE)
-Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
-Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
-void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
-void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
-void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
-void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
-void ImageAlphaClear(Image *image, Color color, float threshold);                                  // Clear alpha channel to desired color
-void ImageAlphaMask(Image *image, Image alphaMask);                                                // Apply alpha mask to image
-void ImageAlphaPremultiply(Image *image);                                                          // Premultiply alpha channel
-void ImageBlurGaussian(Image *image, int blurSize);                                                // Apply Gaussian blur using a box blur approximation
-void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize);                    // Apply custom square convolution kernel to image
-void ImageResize(Image *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
-void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
-void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
-void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
-void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
-void ImageFlipVertical(Image *image);                                                              // Flip image vertically
-void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
-void ImageRotate(Image *image, int degrees);                                                       // Rotate image by input angle in degrees (-359 to 359)
-void ImageRotateCW(Image *image);                                                                  // Rotate image clockwise 90deg
-void ImageRotateCCW(Image *image);                                                                 // Rotate image counter-clockwise 90deg
-void ImageColorTint(Image *image, Color color);                                                    // Modify image color: tint
-void ImageColorInvert(Image *image);                                                               // Modify image color: invert
-void ImageColorGrayscale(Image *image);                                                            // Modify image color: grayscale
-void ImageColorContrast(Image *image, float contrast);                                             // Modify image color: contrast (-100 to 100)
-void ImageColorBrightness(Image *image, int brightness);                                           // Modify image color: brightness (-255 to 255)
-void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
-Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
-Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
-void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
-void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
-Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
-Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
-
-// Image drawing functions
-// NOTE: Image software-rendering functions (CPU)
-void ImageClearBackground(Image *dst, Color color);                                                // Clear image background with given color
-void ImageDrawPixel(Image *dst, int posX, int posY, Color color);                                  // Draw pixel within an image
-void ImageDrawPixelV(Image *dst, Vector2 position, Color color);                                   // Draw pixel within an image (Vector version)
-void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color); // Draw line within an image
-void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color);                          // Draw line within an image (Vector version)
-void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color color);              // Draw a line defining thickness within an image
-void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color);               // Draw a filled circle within an image
-void ImageDrawCircleV(Image *dst, Vector2 center, int radius, Color color);                        // Draw a filled circle within an image (Vector version)
-void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color);          // Draw circle outline within an image
-void ImageDrawCircleLinesV(Image *dst, Vector2 center, int radius, Color color);                   // Draw circle outline within an image (Vector version)
-void ImageDrawRectangle(Image *dst, int posX, int posY, int width, int height, Color color);       // Draw rectangle within an image
-void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color color);                 // Draw rectangle within an image (Vector version)
-void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color);                                // Draw rectangle within an image
-void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color);                   // Draw rectangle lines within an image
-void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);               // Draw triangle within an image
-void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c1, Color c2, Color c3); // Draw triangle with interpolated colors within an image
-void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);          // Draw triangle outline within an image
-void ImageDrawTriangleFan(Image *dst, Vector2 *points, int pointCount, Color color);               // Draw a triangle fan defined by points within an image (first vertex is the center)
-void ImageDrawTriangleStrip(Image *dst, Vector2 *points, int pointCount, Color color);             // Draw a triangle strip defined by points within an image
-void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
-void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
-void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
-
-// Texture loading functions
-// NOTE: These functions require GPU access
-Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
-Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
-TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
-RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
-bool IsTextureValid(Texture2D texture);                                                            // Check if a texture is valid (loaded in GPU)
-void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
-bool IsRenderTextureValid(RenderTexture2D target);                                                 // Check if a render texture is valid (loaded in GPU)
-void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
-void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
-void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
-
-// Texture configuration functions
-void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
-void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
-void SetTextureWrap(Texture2D texture, int wrap);                                                  // Set texture wrapping mode
-
-// Texture drawing functions
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint);                               // Draw a Texture2D
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint);                                // Draw a Texture2D with position defined as Vector2
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint);  // Draw a Texture2D with extended parameters
-void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);            // Draw a part of a texture defined by a rectangle
-void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
-void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
-
-// Color/pixel related functions
-bool ColorIsEqual(Color col1, Color col2);                            // Check if two colors are equal
-Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
-int ColorToInt(Color color);                                          // Get hexadecimal value for a Color (0xRRGGBBAA)
-Vector4 ColorNormalize(Color color);                                  // Get Color normalized as float [0..1]
-Color ColorFromNormalized(Vector4 normalized);                        // Get Color from normalized values [0..1]
-Vector3 ColorToHSV(Color color);                                      // Get HSV values for a Color, hue [0..360], saturation/value [0..1]
-Color ColorFromHSV(float hue, float saturation, float value);         // Get a Color from HSV values, hue [0..360], saturation/value [0..1]
-Color ColorTint(Color color, Color tint);                             // Get color multiplied with another color
-Color ColorBrightness(Color color, float factor);                     // Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
-Color ColorContrast(Color color, float contrast);                     // Get color with contrast correction, contrast values between -1.0f and 1.0f
-Color ColorAlpha(Color color, float alpha);                           // Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color ColorAlphaBlend(Color dst, Color src, Color tint);              // Get src alpha-blended into dst color with tint
-Color ColorLerp(Color color1, Color color2, float factor);            // Get color lerp interpolation between two colors, factor [0.0f..1.0f]
-Color GetColor(unsigned int hexValue);                                // Get Color structure from hexadecimal value
-Color GetPixelColor(void *srcPtr, int format);                        // Get Color from a source pixel pointer of certain format
-void SetPixelColor(void *dstPtr, Color color, int format);            // Set color formatted into destination pixel pointer
-int GetPixelDataSize(int width, int height, int format);              // Get pixel data size in bytes for certain format
-
-//------------------------------------------------------------------------------------
-// Font Loading and Text Drawing Functions (Module: text)
-//------------------------------------------------------------------------------------
-
-// Font loading/unloading functions
-Font GetFontDefault(void);                                                            // Get the default Font
-Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
-Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
-Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
-Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
-bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
-GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
-Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
-void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
-void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
-bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
-
-// Text drawing functions
-void DrawFPS(int posX, int posY);                                                     // Draw current FPS
-void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
-void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
-void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
-void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
-void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
-
-// Text font info functions
-void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
-int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
-Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
-int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
-GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
-Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
-
-// Text codepoints management functions (unicode characters)
-char *LoadUTF8(const int *codepoints, int length);                // Load UTF-8 text encoded from codepoints array
-void UnloadUTF8(char *text);                                      // Unload UTF-8 text encoded from codepoints array
-int *LoadCodepoints(const char *text, int *count);                // Load all codepoints from a UTF-8 text string, codepoints count returned by parameter
-void UnloadCodepoints(int *codepoints);                           // Unload codepoints data from memory
-int GetCodepointCount(const char *text);                          // Get total number of codepoints in a UTF-8 encoded string
-int GetCodepoint(const char *text, int *codepointSize);           // Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
-int GetCodepointNext(const char *text, int *codepointSize);       // Get next codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
-int GetCodepointPrevious(const char *text, int *codepointSize);   // Get previous codepoint in a UTF-8 encoded string, 0x3f('?') is returned on failure
-const char *CodepointToUTF8(int codepoint, int *utf8Size);        // Encode one codepoint into UTF-8 byte array (array length returned as parameter)
-
-// Text strings management functions (no UTF-8 strings, only byte chars)
-// NOTE: Some strings allocate memory internally for returned strings, just be careful!
-int TextCopy(char *dst, const char *src);                                             // Copy one string to another, returns bytes copied
-bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
-unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
-const char *TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf() style)
-const char *TextSubtext(const char *text, int position, int length);                  // Get a piece of a text string
-char *TextReplace(const char *text, const char *replace, const char *by);             // Replace text string (WARNING: memory must be freed!)
-char *TextInsert(const char *text, const char *insert, int position);                 // Insert text in a position (WARNING: memory must be freed!)
-const char *TextJoin(const char **textList, int count, const char *delimiter);        // Join text strings with delimiter
-const char **TextSplit(const char *text, char delimiter, int *count);                 // Split text into multiple strings
-void TextAppend(char *text, const char *append, int *position);                       // Append text at specific position and move cursor!
-int TextFindIndex(const char *text, const char *find);                                // Find first text occurrence within a string
-const char *TextToUpper(const char *text);                      // Get upper case version of provided string
-const char *TextToLower(const char *text);                      // Get lower case version of provided string
-const char *TextToPascal(const char *text);                     // Get Pascal case notation version of provided string
-const char *TextToSnake(const char *text);                      // Get Snake case notation version of provided string
-const char *TextToCamel(const char *text);                      // Get Camel case notation version of provided string
-
-int TextToInteger(const char *text);                            // Get integer value from text (negative values not supported)
-float TextToFloat(const char *text);                            // Get float value from text (negative values not supported)
-
-//------------------------------------------------------------------------------------
-// Basic 3d Shapes Drawing Functions (Module: models)
-//------------------------------------------------------------------------------------
-
-// Basic geometric 3D shapes drawing functions
-void DrawLine3D(Vector3 startPos, Vector3 endPos, Color color);                                    // Draw a line in 3D world space
-void DrawPoint3D(Vector3 position, Color color);                                                   // Draw a point in 3D space, actually a small line
-void DrawCircle3D(Vector3 center, float radius, Vector3 rotationAxis, float rotationAngle, Color color); // Draw a circle in 3D world space
-void DrawTriangle3D(Vector3 v1, Vector3 v2, Vector3 v3, Color color);                              // Draw a color-filled triangle (vertex in counter-clockwise order!)
-void DrawTriangleStrip3D(const Vector3 *points, int pointCount, Color color);                      // Draw a triangle strip defined by points
-void DrawCube(Vector3 position, float width, float height, float length, Color color);             // Draw cube
-void DrawCubeV(Vector3 position, Vector3 size, Color color);                                       // Draw cube (Vector version)
-void DrawCubeWires(Vector3 position, float width, float height, float length, Color color);        // Draw cube wires
-void DrawCubeWiresV(Vector3 position, Vector3 size, Color color);                                  // Draw cube wires (Vector version)
-void DrawSphere(Vector3 centerPos, float radius, Color color);                                     // Draw sphere
-void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color color);            // Draw sphere with extended parameters
-void DrawSphereWires(Vector3 centerPos, float radius, int rings, int slices, Color color);         // Draw sphere wires
-void DrawCylinder(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color); // Draw a cylinder/cone
-void DrawCylinderEx(Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, Color color); // Draw a cylinder with base at startPos and top at endPos
-void DrawCylinderWires(Vector3 position, float radiusTop, float radiusBottom, float height, int slices, Color color); // Draw a cylinder/cone wires
-void DrawCylinderWiresEx(Vector3 startPos, Vector3 endPos, float startRadius, float endRadius, int sides, Color color); // Draw a cylinder wires with base at startPos and top at endPos
-void DrawCapsule(Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, Color color); // Draw a capsule with the center of its sphere caps at startPos and endPos
-void DrawCapsuleWires(Vector3 startPos, Vector3 endPos, float radius, int slices, int rings, Color color); // Draw capsule wireframe with the center of its sphere caps at startPos and endPos
-void DrawPlane(Vector3 centerPos, Vector2 size, Color color);                                      // Draw a plane XZ
-void DrawRay(Ray ray, Color color);                                                                // Draw a ray line
-void DrawGrid(int slices, float spacing);                                                          // Draw a grid (centered at (0, 0, 0))
-
-//------------------------------------------------------------------------------------
-// Model 3d Loading and Drawing Functions (Module: models)
-//------------------------------------------------------------------------------------
-
-// Model management functions
-Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
-Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
-bool IsModelValid(Model model);                                                       // Check if a model is valid (loaded in GPU, VAO/VBOs)
-void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
-BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
-
-// Model drawing functions
-void DrawModel(Model model, Vector3 position, float scale, Color tint);               // Draw a model (with texture if set)
-void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters
-void DrawModelWires(Model model, Vector3 position, float scale, Color tint);          // Draw a model wires (with texture if set)
-void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires (with texture if set) with extended parameters
-void DrawModelPoints(Model model, Vector3 position, float scale, Color tint); // Draw a model as points
-void DrawModelPointsEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model as points with extended parameters
-void DrawBoundingBox(BoundingBox box, Color color);                                   // Draw bounding box (wires)
-void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float scale, Color tint);   // Draw a billboard texture
-void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint); // Draw a billboard texture defined by source
-void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint); // Draw a billboard texture defined by source and rotation
-
-// Mesh management functions
-void UploadMesh(Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
-void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index
-void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
-void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
-void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
-BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
-void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
-bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
-bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
-
-// Mesh generation functions
-Mesh GenMeshPoly(int sides, float radius);                                            // Generate polygonal mesh
-Mesh GenMeshPlane(float width, float length, int resX, int resZ);                     // Generate plane mesh (with subdivisions)
-Mesh GenMeshCube(float width, float height, float length);                            // Generate cuboid mesh
-Mesh GenMeshSphere(float radius, int rings, int slices);                              // Generate sphere mesh (standard sphere)
-Mesh GenMeshHemiSphere(float radius, int rings, int slices);                          // Generate half-sphere mesh (no bottom cap)
-Mesh GenMeshCylinder(float radius, float height, int slices);                         // Generate cylinder mesh
-Mesh GenMeshCone(float radius, float height, int slices);                             // Generate cone/pyramid mesh
-Mesh GenMeshTorus(float radius, float size, int radSeg, int sides);                   // Generate torus mesh
-Mesh GenMeshKnot(float radius, float size, int radSeg, int sides);                    // Generate trefoil knot mesh
-Mesh GenMeshHeightmap(Image heightmap, Vector3 size);                                 // Generate heightmap mesh from image data
-Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize);                               // Generate cubes-based map mesh from image data
-
-// Material loading/unloading functions
-Material *LoadMaterials(const char *fileName, int *materialCount);                    // Load materials from model file
-Material LoadMaterialDefault(void);                                                   // Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
-bool IsMaterialValid(Material material);                                              // Check if a material is valid (shader assigned, map textures loaded in GPU)
-void UnloadMaterial(Material material);                                               // Unload material from GPU memory (VRAM)
-void SetMaterialTexture(Material *material, int mapType, Texture2D texture);          // Set texture for a material map type (MATERIAL_MAP_DIFFUSE, MATERIAL_MAP_SPECULAR...)
-void SetModelMeshMaterial(Model *model, int meshId, int materialId);                  // Set material for a mesh
-
-// Model animations loading/unloading functions
-ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
-void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU)
-void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
-void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
-void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
-bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
-
-// Collision detection functions
-bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2);   // Check collision between two spheres
-bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2);                                 // Check collision between two bounding boxes
-bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius);                  // Check collision between box and sphere
-RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
-RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
-RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
-RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
-RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
-
-//------------------------------------------------------------------------------------
-// Audio Loading and Playing Functions (Module: audio)
-//------------------------------------------------------------------------------------
-typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
-
-// Audio device management functions
-void InitAudioDevice(void);                                     // Initialize audio device and context
-void CloseAudioDevice(void);                                    // Close the audio device and context
-bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
-void SetMasterVolume(float volume);                             // Set master volume (listener)
-float GetMasterVolume(void);                                    // Get master volume (listener)
-
-// Wave/Sound loading/unloading functions
-Wave LoadWave(const char *fileName);                            // Load wave data from file
-Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. '.wav'
-bool IsWaveValid(Wave wave);                                    // Checks if wave data is valid (data loaded and parameters)
-Sound LoadSound(const char *fileName);                          // Load sound from file
-Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
-Sound LoadSoundAlias(Sound source);                             // Create a new sound that shares the same sample data as the source sound, does not own the sound data
-bool IsSoundValid(Sound sound);                                 // Checks if a sound is valid (data loaded and buffers initialized)
-void UpdateSound(Sound sound, const void *data, int sampleCount); // Update sound buffer with new data
-void UnloadWave(Wave wave);                                     // Unload wave data
-void UnloadSound(Sound sound);                                  // Unload sound
-void UnloadSoundAlias(Sound alias);                             // Unload a sound alias (does not deallocate sample data)
-bool ExportWave(Wave wave, const char *fileName);               // Export wave data to file, returns true on success
-bool ExportWaveAsCode(Wave wave, const char *fileName);         // Export wave sample data to code (.h), returns true on success
-
-// Wave/Sound management functions
-void PlaySound(Sound sound);                                    // Play a sound
-void StopSound(Sound sound);                                    // Stop playing a sound
-void PauseSound(Sound sound);                                   // Pause a sound
-void ResumeSound(Sound sound);                                  // Resume a paused sound
-bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
-void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
-void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
-void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
-Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
-void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
-void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
-float *LoadWaveSamples(Wave wave);                              // Load samples data from wave as a 32bit float data array
-void UnloadWaveSamples(float *samples);                         // Unload samples data loaded with LoadWaveSamples()
-
-// Music management functions
-Music LoadMusicStream(const char *fileName);                    // Load music stream from file
-Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize); // Load music stream from data
-bool IsMusicValid(Music music);                                 // Checks if a music stream is valid (context and buffers initialized)
-void UnloadMusicStream(Music music);                            // Unload music stream
-void PlayMusicStream(Music music);                              // Start music playing
-bool IsMusicStreamPlaying(Music music);                         // Check if music is playing
-void UpdateMusicStream(Music music);                            // Updates buffers for music streaming
-void StopMusicStream(Music music);                              // Stop music playing
-void PauseMusicStream(Music music);                             // Pause music playing
-void ResumeMusicStream(Music music);                            // Resume playing paused music
-void SeekMusicStream(Music music, float position);              // Seek music to a position (in seconds)
-void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
-void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
-void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
-float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
-float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
-
-// AudioStream management functions
-AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
-bool IsAudioStreamValid(AudioStream stream);                    // Checks if an audio stream is valid (buffers initialized)
-void UnloadAudioStream(AudioStream stream);                     // Unload audio stream and free memory
-void UpdateAudioStream(AudioStream stream, const void *data, int frameCount); // Update audio stream buffers with data
-bool IsAudioStreamProcessed(AudioStream stream);                // Check if any audio stream buffers requires refill
-void PlayAudioStream(AudioStream stream);                       // Play audio stream
-void PauseAudioStream(AudioStream stream);                      // Pause audio stream
-void ResumeAudioStream(AudioStream stream);                     // Resume audio stream
-bool IsAudioStreamPlaying(AudioStream stream);                  // Check if audio stream is playing
-void StopAudioStream(AudioStream stream);                       // Stop audio stream
-void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
-void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
-void SetAudioStreamPan(AudioStream stream, float pan);          // Set pan for audio stream (0.5 is centered)
-void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
-void SetAudioStreamCallback(AudioStream stream, AudioCallback callback); // Audio thread callback to request new data
-
-void AttachAudioStreamProcessor(AudioStream stream, AudioCallback processor); // Attach audio stream processor to stream, receives the samples as 'float'
-void DetachAudioStreamProcessor(AudioStream stream, AudioCallback processor); // Detach audio stream processor from stream
-
-void AttachAudioMixedProcessor(AudioCallback processor); // Attach audio stream processor to the entire audio pipeline, receives the samples as 'float'
-void DetachAudioMixedProcessor(AudioCallback processor); // Detach audio stream processor from the entire audio pipeline
-
-// MATH module
-typedef struct float3 {
-    float v[3];
-} float3;
-typedef struct float16 {
-    float v[16];
-} float16;
-typedef Vector4 Quaternion;
-float Clamp(float value, float min, float max);
-float Lerp(float start, float end, float amount);
-float Normalize(float value, float start, float end);
-float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd);
-float Wrap(float value, float min, float max);
-int FloatEquals(float x, float y);
-Vector2 Vector2Zero(void);
-Vector2 Vector2One(void);
-Vector2 Vector2Add(Vector2 v1, Vector2 v2);
-Vector2 Vector2AddValue(Vector2 v, float add);
-Vector2 Vector2Subtract(Vector2 v1, Vector2 v2);
-Vector2 Vector2SubtractValue(Vector2 v, float sub);
-float Vector2Length(Vector2 v);
-float Vector2LengthSqr(Vector2 v);
-float Vector2DotProduct(Vector2 v1, Vector2 v2);
-float Vector2Distance(Vector2 v1, Vector2 v2);
-float Vector2DistanceSqr(Vector2 v1, Vector2 v2);
-float Vector2Angle(Vector2 v1, Vector2 v2);
-float Vector2LineAngle(Vector2 start, Vector2 end);
-Vector2 Vector2Scale(Vector2 v, float scale);
-Vector2 Vector2Multiply(Vector2 v1, Vector2 v2);
-Vector2 Vector2Negate(Vector2 v);
-Vector2 Vector2Divide(Vector2 v1, Vector2 v2);
-Vector2 Vector2Normalize(Vector2 v);
-Vector2 Vector2Transform(Vector2 v, Matrix mat);
-Vector2 Vector2Lerp(Vector2 v1, Vector2 v2, float amount);
-Vector2 Vector2Reflect(Vector2 v, Vector2 normal);
-Vector2 Vector2Min(Vector2 v1, Vector2 v2);
-Vector2 Vector2Max(Vector2 v1, Vector2 v2);
-Vector2 Vector2Rotate(Vector2 v, float angle);
-Vector2 Vector2MoveTowards(Vector2 v, Vector2 target, float maxDistance);
-Vector2 Vector2Invert(Vector2 v);
-Vector2 Vector2Clamp(Vector2 v, Vector2 min, Vector2 max);
-Vector2 Vector2ClampValue(Vector2 v, float min, float max);
-int Vector2Equals(Vector2 p, Vector2 q);
-Vector2 Vector2Refract(Vector2 v, Vector2 n, float r);
-Vector3 Vector3Zero(void);
-Vector3 Vector3One(void);
-Vector3 Vector3Add(Vector3 v1, Vector3 v2);
-Vector3 Vector3AddValue(Vector3 v, float add);
-Vector3 Vector3Subtract(Vector3 v1, Vector3 v2);
-Vector3 Vector3SubtractValue(Vector3 v, float sub);
-Vector3 Vector3Scale(Vector3 v, float scalar);
-Vector3 Vector3Multiply(Vector3 v1, Vector3 v2);
-Vector3 Vector3CrossProduct(Vector3 v1, Vector3 v2);
-Vector3 Vector3Perpendicular(Vector3 v);
-float Vector3Length(const Vector3 v);
-float Vector3LengthSqr(const Vector3 v);
-float Vector3DotProduct(Vector3 v1, Vector3 v2);
-float Vector3Distance(Vector3 v1, Vector3 v2);
-float Vector3DistanceSqr(Vector3 v1, Vector3 v2);
-float Vector3Angle(Vector3 v1, Vector3 v2);
-Vector3 Vector3Negate(Vector3 v);
-Vector3 Vector3Divide(Vector3 v1, Vector3 v2);
-Vector3 Vector3Normalize(Vector3 v);
-Vector3 Vector3Project(Vector3 v1, Vector3 v2);
-Vector3 Vector3Reject(Vector3 v1, Vector3 v2);
-void Vector3OrthoNormalize(Vector3 *v1, Vector3 *v2);
-Vector3 Vector3Transform(Vector3 v, Matrix mat);
-Vector3 Vector3RotateByQuaternion(Vector3 v, Quaternion q);
-Vector3 Vector3RotateByAxisAngle(Vector3 v, Vector3 axis, float angle);
-Vector3 Vector3MoveTowards(Vector3 v, Vector3 target, float maxDistance);
-Vector3 Vector3Lerp(Vector3 v1, Vector3 v2, float amount);
-Vector3 Vector3CubicHermite(Vector3 v1, Vector3 tangent1, Vector3 v2, Vector3 tangent2, float amount);
-Vector3 Vector3Reflect(Vector3 v, Vector3 normal);
-Vector3 Vector3Min(Vector3 v1, Vector3 v2);
-Vector3 Vector3Max(Vector3 v1, Vector3 v2);
-Vector3 Vector3Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c);
-Vector3 Vector3Unproject(Vector3 source, Matrix projection, Matrix view);
-float3 Vector3ToFloatV(Vector3 v);
-Vector3 Vector3Invert(Vector3 v);
-Vector3 Vector3Clamp(Vector3 v, Vector3 min, Vector3 max);
-Vector3 Vector3ClampValue(Vector3 v, float min, float max);
-int Vector3Equals(Vector3 p, Vector3 q);
-Vector3 Vector3Refract(Vector3 v, Vector3 n, float r);
-Vector4 Vector4Zero(void);
-Vector4 Vector4One(void);
-Vector4 Vector4Add(Vector4 v1, Vector4 v2);
-Vector4 Vector4AddValue(Vector4 v, float add);
-Vector4 Vector4Subtract(Vector4 v1, Vector4 v2);
-Vector4 Vector4SubtractValue(Vector4 v, float add);
-float Vector4Length(Vector4 v);
-float Vector4LengthSqr(Vector4 v);
-float Vector4DotProduct(Vector4 v1, Vector4 v2);
-float Vector4Distance(Vector4 v1, Vector4 v2);
-float Vector4DistanceSqr(Vector4 v1, Vector4 v2);
-Vector4 Vector4Scale(Vector4 v, float scale);
-Vector4 Vector4Multiply(Vector4 v1, Vector4 v2);
-Vector4 Vector4Negate(Vector4 v);
-Vector4 Vector4Divide(Vector4 v1, Vector4 v2);
-Vector4 Vector4Normalize(Vector4 v);
-Vector4 Vector4Min(Vector4 v1, Vector4 v2);
-Vector4 Vector4Max(Vector4 v1, Vector4 v2);
-Vector4 Vector4Lerp(Vector4 v1, Vector4 v2, float amount);
-Vector4 Vector4MoveTowards(Vector4 v, Vector4 target, float maxDistance);
-Vector4 Vector4Invert(Vector4 v);
-int Vector4Equals(Vector4 p, Vector4 q);
-float MatrixDeterminant(Matrix mat);
-float MatrixTrace(Matrix mat);
-Matrix MatrixTranspose(Matrix mat);
-Matrix MatrixInvert(Matrix mat);
-Matrix MatrixIdentity(void);
-Matrix MatrixAdd(Matrix left, Matrix right);
-Matrix MatrixSubtract(Matrix left, Matrix right);
-Matrix MatrixMultiply(Matrix left, Matrix right);
-Matrix MatrixTranslate(float x, float y, float z);
-Matrix MatrixRotate(Vector3 axis, float angle);
-Matrix MatrixRotateX(float angle);
-Matrix MatrixRotateY(float angle);
-Matrix MatrixRotateZ(float angle);
-Matrix MatrixRotateXYZ(Vector3 angle);
-Matrix MatrixRotateZYX(Vector3 angle);
-Matrix MatrixScale(float x, float y, float z);
-Matrix MatrixFrustum(double left, double right, double bottom, double top, double nearPlane, double farPlane);
-Matrix MatrixPerspective(double fovY, double aspect, double nearPlane, double farPlane);
-Matrix MatrixOrtho(double left, double right, double bottom, double top, double nearPlane, double farPlane);
-Matrix MatrixLookAt(Vector3 eye, Vector3 target, Vector3 up);
-float16 MatrixToFloatV(Matrix mat);
-Quaternion QuaternionAdd(Quaternion q1, Quaternion q2);
-Quaternion QuaternionAddValue(Quaternion q, float add);
-Quaternion QuaternionSubtract(Quaternion q1, Quaternion q2);
-Quaternion QuaternionSubtractValue(Quaternion q, float sub);
-Quaternion QuaternionIdentity(void);
-float QuaternionLength(Quaternion q);
-Quaternion QuaternionNormalize(Quaternion q);
-Quaternion QuaternionInvert(Quaternion q);
-Quaternion QuaternionMultiply(Quaternion q1, Quaternion q2);
-Quaternion QuaternionScale(Quaternion q, float mul);
-Quaternion QuaternionDivide(Quaternion q1, Quaternion q2);
-Quaternion QuaternionLerp(Quaternion q1, Quaternion q2, float amount);
-Quaternion QuaternionNlerp(Quaternion q1, Quaternion q2, float amount);
-Quaternion QuaternionSlerp(Quaternion q1, Quaternion q2, float amount);
-Quaternion QuaternionCubicHermiteSpline(Quaternion q1, Quaternion outTangent1, Quaternion q2, Quaternion inTangent2, float t);
-Quaternion QuaternionFromVector3ToVector3(Vector3 from, Vector3 to);
-Quaternion QuaternionFromMatrix(Matrix mat);
-Matrix QuaternionToMatrix(Quaternion q);
-Quaternion QuaternionFromAxisAngle(Vector3 axis, float angle);
-void QuaternionToAxisAngle(Quaternion q, Vector3 *outAxis, float *outAngle);
-Quaternion QuaternionFromEuler(float pitch, float yaw, float roll);
-Vector3 QuaternionToEuler(Quaternion q);
-Quaternion QuaternionTransform(Quaternion q, Matrix mat);
-int QuaternionEquals(Quaternion p, Quaternion q);
-void MatrixDecompose(Matrix mat, Vector3 *translation, Quaternion *rotation, Vector3 *scale);
-
-// GUI module ---------------------------------------------------------------------------------
-// Global gui state control functions
-void GuiEnable(void);                                 // Enable gui controls (global state)
-void GuiDisable(void);                                // Disable gui controls (global state)
-void GuiLock(void);                                   // Lock gui controls (global state)
-void GuiUnlock(void);                                 // Unlock gui controls (global state)
-bool GuiIsLocked(void);                               // Check if gui is locked (global state)
-void GuiSetAlpha(float alpha);                        // Set gui controls alpha (global state), alpha goes from 0.0f to 1.0f
-void GuiSetState(int state);                          // Set gui state (global state)
-int GuiGetState(void);                                // Get gui state (global state)
-
-// Font set/get functions
-void GuiSetFont(Font font);                           // Set gui custom font (global state)
-Font GuiGetFont(void);                                // Get gui custom font (global state)
-
-// Style set/get functions
-void GuiSetStyle(int control, int property, int value); // Set one style property
-int GuiGetStyle(int control, int property);           // Get one style property
-
-// Styles loading functions
-void GuiLoadStyle(const char *fileName);              // Load style file over global style variable (.rgs)
-void GuiLoadStyleDefault(void);                       // Load style default over global style
-
-// Tooltips management functions
-void GuiEnableTooltip(void);                          // Enable gui tooltips (global state)
-void GuiDisableTooltip(void);                         // Disable gui tooltips (global state)
-void GuiSetTooltip(const char *tooltip);              // Set tooltip string
-
-// Icons functionality
-const char *GuiIconText(int iconId, const char *text); // Get text with icon id prepended (if supported)
-#if !defined(RAYGUI_NO_ICONS)
-void GuiSetIconScale(int scale);                      // Set default icon drawing size
-unsigned int *GuiGetIcons(void);                      // Get raygui icons data pointer
-char **GuiLoadIcons(const char *fileName, bool loadIconsName); // Load raygui icons file (.rgi) into internal icons data
-void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color); // Draw icon using pixel size at specified position
-#endif
-
-
-// Controls
-//----------------------------------------------------------------------------------------------------------
-// Container/separator controls, useful for controls organization
-int GuiWindowBox(Rectangle bounds, const char *title);                                       // Window Box control, shows a window that can be closed
-int GuiGroupBox(Rectangle bounds, const char *text);                                         // Group Box control with text name
-int GuiLine(Rectangle bounds, const char *text);                                             // Line separator control, could contain text
-int GuiPanel(Rectangle bounds, const char *text);                                            // Panel control, useful to group controls
-int GuiTabBar(Rectangle bounds, const char **text, int count, int *active);                  // Tab Bar control, returns TAB to be closed or -1
-int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector2 *scroll, Rectangle *view); // Scroll Panel control
-
-// Basic controls set
-int GuiLabel(Rectangle bounds, const char *text);                                            // Label control, shows text
-int GuiButton(Rectangle bounds, const char *text);                                           // Button control, returns true when clicked
-int GuiLabelButton(Rectangle bounds, const char *text);                                      // Label button control, show true when clicked
-int GuiToggle(Rectangle bounds, const char *text, bool *active);                             // Toggle Button control, returns true when active
-int GuiToggleGroup(Rectangle bounds, const char *text, int *active);                         // Toggle Group control, returns active toggle index
-int GuiToggleSlider(Rectangle bounds, const char *text, int *active);                        // Toggle Slider control, returns true when clicked
-int GuiCheckBox(Rectangle bounds, const char *text, bool *checked);                          // Check Box control, returns true when active
-int GuiComboBox(Rectangle bounds, const char *text, int *active);                            // Combo Box control, returns selected item index
-
-int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMode);          // Dropdown Box control, returns selected item
-int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode); // Spinner control, returns selected value
-int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode); // Value Box control, updates input text with numbers
-int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode);                   // Text Box control, updates input text
-
-int GuiSlider(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue); // Slider control, returns selected value
-int GuiSliderBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue); // Slider Bar control, returns selected value
-int GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue); // Progress Bar control, shows current progress value
-int GuiStatusBar(Rectangle bounds, const char *text);                                        // Status Bar control, shows info text
-int GuiDummyRec(Rectangle bounds, const char *text);                                         // Dummy control for placeholders
-int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vector2 *mouseCell); // Grid control, returns mouse cell position
-
-// Advance controls set
-int GuiListView(Rectangle bounds, const char *text, int *scrollIndex, int *active);          // List View control, returns selected list item index
-int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollIndex, int *active, int *focus); // List View with extended parameters
-int GuiMessageBox(Rectangle bounds, const char *title, const char *message, const char *buttons); // Message Box control, displays a message
-int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, const char *buttons, char *text, int textMaxSize, bool *secretViewActive); // Text Input Box control, ask for text, supports secret
-int GuiColorPicker(Rectangle bounds, const char *text, Color *color);                        // Color Picker control (multiple color controls)
-int GuiColorPanel(Rectangle bounds, const char *text, Color *color);                         // Color Panel control
-int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha);                      // Color Bar Alpha control
-int GuiColorBarHue(Rectangle bounds, const char *text, float *value);                        // Color Bar Hue control
-int GuiColorPickerHSV(Rectangle bounds, const char *text, Vector3 *colorHsv);                // Color Picker control that avoids conversion to RGB on each call (multiple color controls)
-int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv);                 // Color Panel control that returns HSV color value, used by GuiColorPickerHSV()
-
-typedef enum {
-    ICON_NONE                     = 0,
-    ICON_FOLDER_FILE_OPEN         = 1,
-    ICON_FILE_SAVE_CLASSIC        = 2,
-    ICON_FOLDER_OPEN              = 3,
-    ICON_FOLDER_SAVE              = 4,
-    ICON_FILE_OPEN                = 5,
-    ICON_FILE_SAVE                = 6,
-    ICON_FILE_EXPORT              = 7,
-    ICON_FILE_ADD                 = 8,
-    ICON_FILE_DELETE              = 9,
-    ICON_FILETYPE_TEXT            = 10,
-    ICON_FILETYPE_AUDIO           = 11,
-    ICON_FILETYPE_IMAGE           = 12,
-    ICON_FILETYPE_PLAY            = 13,
-    ICON_FILETYPE_VIDEO           = 14,
-    ICON_FILETYPE_INFO            = 15,
-    ICON_FILE_COPY                = 16,
-    ICON_FILE_CUT                 = 17,
-    ICON_FILE_PASTE               = 18,
-    ICON_CURSOR_HAND              = 19,
-    ICON_CURSOR_POINTER           = 20,
-    ICON_CURSOR_CLASSIC           = 21,
-    ICON_PENCIL                   = 22,
-    ICON_PENCIL_BIG               = 23,
-    ICON_BRUSH_CLASSIC            = 24,
-    ICON_BRUSH_PAINTER            = 25,
-    ICON_WATER_DROP               = 26,
-    ICON_COLOR_PICKER             = 27,
-    ICON_RUBBER                   = 28,
-    ICON_COLOR_BUCKET             = 29,
-    ICON_TEXT_T                   = 30,
-    ICON_TEXT_A                   = 31,
-    ICON_SCALE                    = 32,
-    ICON_RESIZE                   = 33,
-    ICON_FILTER_POINT             = 34,
-    ICON_FILTER_BILINEAR          = 35,
-    ICON_CROP                     = 36,
-    ICON_CROP_ALPHA               = 37,
-    ICON_SQUARE_TOGGLE            = 38,
-    ICON_SYMMETRY                 = 39,
-    ICON_SYMMETRY_HORIZONTAL      = 40,
-    ICON_SYMMETRY_VERTICAL        = 41,
-    ICON_LENS                     = 42,
-    ICON_LENS_BIG                 = 43,
-    ICON_EYE_ON                   = 44,
-    ICON_EYE_OFF                  = 45,
-    ICON_FILTER_TOP               = 46,
-    ICON_FILTER                   = 47,
-    ICON_TARGET_POINT             = 48,
-    ICON_TARGET_SMALL             = 49,
-    ICON_TARGET_BIG               = 50,
-    ICON_TARGET_MOVE              = 51,
-    ICON_CURSOR_MOVE              = 52,
-    ICON_CURSOR_SCALE             = 53,
-    ICON_CURSOR_SCALE_RIGHT       = 54,
-    ICON_CURSOR_SCALE_LEFT        = 55,
-    ICON_UNDO                     = 56,
-    ICON_REDO                     = 57,
-    ICON_REREDO                   = 58,
-    ICON_MUTATE                   = 59,
-    ICON_ROTATE                   = 60,
-    ICON_REPEAT                   = 61,
-    ICON_SHUFFLE                  = 62,
-    ICON_EMPTYBOX                 = 63,
-    ICON_TARGET                   = 64,
-    ICON_TARGET_SMALL_FILL        = 65,
-    ICON_TARGET_BIG_FILL          = 66,
-    ICON_TARGET_MOVE_FILL         = 67,
-    ICON_CURSOR_MOVE_FILL         = 68,
-    ICON_CURSOR_SCALE_FILL        = 69,
-    ICON_CURSOR_SCALE_RIGHT_FILL  = 70,
-    ICON_CURSOR_SCALE_LEFT_FILL   = 71,
-    ICON_UNDO_FILL                = 72,
-    ICON_REDO_FILL                = 73,
-    ICON_REREDO_FILL              = 74,
-    ICON_MUTATE_FILL              = 75,
-    ICON_ROTATE_FILL              = 76,
-    ICON_REPEAT_FILL              = 77,
-    ICON_SHUFFLE_FILL             = 78,
-    ICON_EMPTYBOX_SMALL           = 79,
-    ICON_BOX                      = 80,
-    ICON_BOX_TOP                  = 81,
-    ICON_BOX_TOP_RIGHT            = 82,
-    ICON_BOX_RIGHT                = 83,
-    ICON_BOX_BOTTOM_RIGHT         = 84,
-    ICON_BOX_BOTTOM               = 85,
-    ICON_BOX_BOTTOM_LEFT          = 86,
-    ICON_BOX_LEFT                 = 87,
-    ICON_BOX_TOP_LEFT             = 88,
-    ICON_BOX_CENTER               = 89,
-    ICON_BOX_CIRCLE_MASK          = 90,
-    ICON_POT                      = 91,
-    ICON_ALPHA_MULTIPLY           = 92,
-    ICON_ALPHA_CLEAR              = 93,
-    ICON_DITHERING                = 94,
-    ICON_MIPMAPS                  = 95,
-    ICON_BOX_GRID                 = 96,
-    ICON_GRID                     = 97,
-    ICON_BOX_CORNERS_SMALL        = 98,
-    ICON_BOX_CORNERS_BIG          = 99,
-    ICON_FOUR_BOXES               = 100,
-    ICON_GRID_FILL                = 101,
-    ICON_BOX_MULTISIZE            = 102,
-    ICON_ZOOM_SMALL               = 103,
-    ICON_ZOOM_MEDIUM              = 104,
-    ICON_ZOOM_BIG                 = 105,
-    ICON_ZOOM_ALL                 = 106,
-    ICON_ZOOM_CENTER              = 107,
-    ICON_BOX_DOTS_SMALL           = 108,
-    ICON_BOX_DOTS_BIG             = 109,
-    ICON_BOX_CONCENTRIC           = 110,
-    ICON_BOX_GRID_BIG             = 111,
-    ICON_OK_TICK                  = 112,
-    ICON_CROSS                    = 113,
-    ICON_ARROW_LEFT               = 114,
-    ICON_ARROW_RIGHT              = 115,
-    ICON_ARROW_DOWN               = 116,
-    ICON_ARROW_UP                 = 117,
-    ICON_ARROW_LEFT_FILL          = 118,
-    ICON_ARROW_RIGHT_FILL         = 119,
-    ICON_ARROW_DOWN_FILL          = 120,
-    ICON_ARROW_UP_FILL            = 121,
-    ICON_AUDIO                    = 122,
-    ICON_FX                       = 123,
-    ICON_WAVE                     = 124,
-    ICON_WAVE_SINUS               = 125,
-    ICON_WAVE_SQUARE              = 126,
-    ICON_WAVE_TRIANGULAR          = 127,
-    ICON_CROSS_SMALL              = 128,
-    ICON_PLAYER_PREVIOUS          = 129,
-    ICON_PLAYER_PLAY_BACK         = 130,
-    ICON_PLAYER_PLAY              = 131,
-    ICON_PLAYER_PAUSE             = 132,
-    ICON_PLAYER_STOP              = 133,
-    ICON_PLAYER_NEXT              = 134,
-    ICON_PLAYER_RECORD            = 135,
-    ICON_MAGNET                   = 136,
-    ICON_LOCK_CLOSE               = 137,
-    ICON_LOCK_OPEN                = 138,
-    ICON_CLOCK                    = 139,
-    ICON_TOOLS                    = 140,
-    ICON_GEAR                     = 141,
-    ICON_GEAR_BIG                 = 142,
-    ICON_BIN                      = 143,
-    ICON_HAND_POINTER             = 144,
-    ICON_LASER                    = 145,
-    ICON_COIN                     = 146,
-    ICON_EXPLOSION                = 147,
-    ICON_1UP                      = 148,
-    ICON_PLAYER                   = 149,
-    ICON_PLAYER_JUMP              = 150,
-    ICON_KEY                      = 151,
-    ICON_DEMON                    = 152,
-    ICON_TEXT_POPUP               = 153,
-    ICON_GEAR_EX                  = 154,
-    ICON_CRACK                    = 155,
-    ICON_CRACK_POINTS             = 156,
-    ICON_STAR                     = 157,
-    ICON_DOOR                     = 158,
-    ICON_EXIT                     = 159,
-    ICON_MODE_2D                  = 160,
-    ICON_MODE_3D                  = 161,
-    ICON_CUBE                     = 162,
-    ICON_CUBE_FACE_TOP            = 163,
-    ICON_CUBE_FACE_LEFT           = 164,
-    ICON_CUBE_FACE_FRONT          = 165,
-    ICON_CUBE_FACE_BOTTOM         = 166,
-    ICON_CUBE_FACE_RIGHT          = 167,
-    ICON_CUBE_FACE_BACK           = 168,
-    ICON_CAMERA                   = 169,
-    ICON_SPECIAL                  = 170,
-    ICON_LINK_NET                 = 171,
-    ICON_LINK_BOXES               = 172,
-    ICON_LINK_MULTI               = 173,
-    ICON_LINK                     = 174,
-    ICON_LINK_BROKE               = 175,
-    ICON_TEXT_NOTES               = 176,
-    ICON_NOTEBOOK                 = 177,
-    ICON_SUITCASE                 = 178,
-    ICON_SUITCASE_ZIP             = 179,
-    ICON_MAILBOX                  = 180,
-    ICON_MONITOR                  = 181,
-    ICON_PRINTER                  = 182,
-    ICON_PHOTO_CAMERA             = 183,
-    ICON_PHOTO_CAMERA_FLASH       = 184,
-    ICON_HOUSE                    = 185,
-    ICON_HEART                    = 186,
-    ICON_CORNER                   = 187,
-    ICON_VERTICAL_BARS            = 188,
-    ICON_VERTICAL_BARS_FILL       = 189,
-    ICON_LIFE_BARS                = 190,
-    ICON_INFO                     = 191,
-    ICON_CROSSLINE                = 192,
-    ICON_HELP                     = 193,
-    ICON_FILETYPE_ALPHA           = 194,
-    ICON_FILETYPE_HOME            = 195,
-    ICON_LAYERS_VISIBLE           = 196,
-    ICON_LAYERS                   = 197,
-    ICON_WINDOW                   = 198,
-    ICON_HIDPI                    = 199,
-    ICON_FILETYPE_BINARY          = 200,
-    ICON_HEX                      = 201,
-    ICON_SHIELD                   = 202,
-    ICON_FILE_NEW                 = 203,
-    ICON_FOLDER_ADD               = 204,
-    ICON_ALARM                    = 205,
-    ICON_CPU                      = 206,
-    ICON_ROM                      = 207,
-    ICON_STEP_OVER                = 208,
-    ICON_STEP_INTO                = 209,
-    ICON_STEP_OUT                 = 210,
-    ICON_RESTART                  = 211,
-    ICON_BREAKPOINT_ON            = 212,
-    ICON_BREAKPOINT_OFF           = 213,
-    ICON_BURGER_MENU              = 214,
-    ICON_CASE_SENSITIVE           = 215,
-    ICON_REG_EXP                  = 216,
-    ICON_FOLDER                   = 217,
-    ICON_FILE                     = 218,
-    ICON_SAND_TIMER               = 219,
-    ICON_WARNING                  = 220,
-    ICON_HELP_BOX                 = 221,
-    ICON_INFO_BOX                 = 222,
-    ICON_PRIORITY                 = 223,
-    ICON_LAYERS_ISO               = 224,
-    ICON_LAYERS2                  = 225,
-    ICON_MLAYERS                  = 226,
-    ICON_MAPS                     = 227,
-    ICON_HOT                      = 228,
-    ICON_LABEL                    = 229,
-    ICON_NAME_ID                  = 230,
-    ICON_SLICING                  = 231,
-    ICON_MANUAL_CONTROL           = 232,
-    ICON_COLLISION                = 233,
-    ICON_234                      = 234,
-    ICON_235                      = 235,
-    ICON_236                      = 236,
-    ICON_237                      = 237,
-    ICON_238                      = 238,
-    ICON_239                      = 239,
-    ICON_240                      = 240,
-    ICON_241                      = 241,
-    ICON_242                      = 242,
-    ICON_243                      = 243,
-    ICON_244                      = 244,
-    ICON_245                      = 245,
-    ICON_246                      = 246,
-    ICON_247                      = 247,
-    ICON_248                      = 248,
-    ICON_249                      = 249,
-    ICON_250                      = 250,
-    ICON_251                      = 251,
-    ICON_252                      = 252,
-    ICON_253                      = 253,
-    ICON_254                      = 254,
-    ICON_255                      = 255,
-} GuiIconName;
\ No newline at end of file
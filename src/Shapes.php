@@ -8,12 +8,25 @@ use Kingbes\Raylib\Utils\Texture;
 use Kingbes\Raylib\Utils\Rectangle;
 use Kingbes\Raylib\Utils\Color;
 use Kingbes\Raylib\Utils\Vector2;
+use Kingbes\Raylib\Utils\Vector2Buffer;
+use \FFI\CData;
+use \FFI\CType;
 
 /**
  * Shapes类
  */
 class Shapes extends Base
 {
+    // 头文件模块
+    protected const MODULE = 'shapes';
+
+    // 批量矩形记录大小：float x, y, width, height + unsigned char r, g, b, a
+    public const RECTANGLE_RECORD_SIZE = 20;
+
+    // 批量矩形记录类型与记录指针类型
+    private static CType $rectangleRecord;
+    private static CType $rectangleRecordPointer;
+
     //### 设置形状绘制使用的纹理和矩形
     //> 注意：当使用基本形状和单一字体时，此功能可能有用，\n定义字体字符的白色矩形可以在单次绘制调用中完成所有绘制
 
@@ -62,7 +75,7 @@ class Shapes extends Base
      */
     public static function drawPixel(int $posX, int $posY, Color $color): void
     {
-        self::ffi()->DrawPixel($posX, $posY, $color->struct());
+        self::ffi()->DrawPixel($posX, $posY, $color->cdata());
     }
 
     /**
@@ -74,7 +87,7 @@ class Shapes extends Base
      */
     public static function drawPixelV(Vector2 $position, Color $color): void
     {
-        self::ffi()->DrawPixelV($position->struct(), $color->struct());
+        self::ffi()->DrawPixelV($position->struct(), $color->cdata());
     }
 
     /**
@@ -89,7 +102,7 @@ class Shapes extends Base
      */
     public static function drawLine(int $startPosX, int $startPosY, int $endPosX, int $endPosY, Color $color): void
     {
-        self::ffi()->DrawLine($startPosX, $startPosY, $endPosX, $endPosY, $color->struct());
+        self::ffi()->DrawLine($startPosX, $startPosY, $endPosX, $endPosY, $color->cdata());
     }
 
     /**
@@ -102,7 +115,7 @@ class Shapes extends Base
      */
     public static function drawLineV(Vector2 $startPos, Vector2 $endPos, Color $color): void
     {
-        self::ffi()->DrawLineV($startPos->struct(), $endPos->struct(), $color->struct());
+        self::ffi()->DrawLineV($startPos->struct(), $endPos->struct(), $color->cdata());
     }
 
     /**
@@ -116,28 +129,22 @@ class Shapes extends Base
      */
     public static function drawLineEx(Vector2 $startPos, Vector2 $endPos, float $thick, Color $color): void
     {
-        self::ffi()->DrawLineEx($startPos->struct(), $endPos->struct(), $thick, $color->struct());
+        self::ffi()->DrawLineEx($startPos->struct(), $endPos->struct(), $thick, $color->cdata());
     }
 
     /**
      * 绘制连续折线（使用GL线条）
      *
-     * @param Vector2[] $points 点集
-     * @param integer $pointCount 点的数量
+     * @param Vector2[]|Vector2Buffer $points 点集
+     * @param integer $pointCount 点的数量（不能超过点集大小）
      * @param Color $color 颜色
      * @return void
+     * @throws \OutOfRangeException 如果点的数量超出点集
      */
-    public static function drawLineStrip(array $points, int $pointCount, Color $color): void
+    public static function drawLineStrip(array|Vector2Buffer $points, int $pointCount, Color $color): void
     {
-        $c_points = self::ffi()->new('struct Vector2[' . count($points) . ']');
-        foreach ($points as $key => $value) {
-            $c_points[$key] = $value->struct();
-        }
-        self::ffi()->DrawLineStrip(
-            self::ffi()->cast('struct Vector2*', $c_points),
-            $pointCount,
-            $color->struct()
-        );
+        self::checkPointCount($points, $pointCount);
+        self::ffi()->DrawLineStrip(self::points($points), $pointCount, $color->cdata());
     }
 
     /**
@@ -151,7 +158,7 @@ class Shapes extends Base
      */
     public static function drawLineBezier(Vector2 $startPos, Vector2 $endPos, float $thick, Color $color): void
     {
-        self::ffi()->DrawLineBezier($startPos->struct(), $endPos->struct(), $thick, $color->struct());
+        self::ffi()->DrawLineBezier($startPos->struct(), $endPos->struct(), $thick, $color->cdata());
     }
 
     /**
@@ -165,7 +172,7 @@ class Shapes extends Base
      */
     public static function drawCircle(int $centerX, int $centerY, float $radius, Color $color): void
     {
-        self::ffi()->DrawCircle($centerX, $centerY, $radius, $color->struct());
+        self::ffi()->DrawCircle($centerX, $centerY, $radius, $color->cdata());
     }
 
     /**
@@ -181,7 +188,7 @@ class Shapes extends Base
      */
     public static function drawCircleSector(Vector2 $center, float $radius, float $startAngle, float $endAngle, int $segments, Color $color): void
     {
-        self::ffi()->DrawCircleSector($center->struct(), $radius, $startAngle, $endAngle, $segments, $color->struct());
+        self::ffi()->DrawCircleSector($center->struct(), $radius, $startAngle, $endAngle, $segments, $color->cdata());
     }
 
     /**
@@ -197,7 +204,7 @@ class Shapes extends Base
      */
     public static function drawCircleSectorLines(Vector2 $center, float $radius, float $startAngle, float $endAngle, int $segments, Color $color): void
     {
-        self::ffi()->DrawCircleSectorLines($center->struct(), $radius, $startAngle, $endAngle, $segments, $color->struct());
+        self::ffi()->DrawCircleSectorLines($center->struct(), $radius, $startAngle, $endAngle, $segments, $color->cdata());
     }
 
     /**
@@ -212,7 +219,7 @@ class Shapes extends Base
      */
     public static function drawCircleGradient(int $centerX, int $centerY, float $radius, Color $inner, Color $outer): void
     {
-        self::ffi()->DrawCircleGradient($centerX, $centerY, $radius, $inner->struct(), $outer->struct());
+        self::ffi()->DrawCircleGradient($centerX, $centerY, $radius, $inner->cdata(), $outer->cdata());
     }
 
     /**
@@ -225,7 +232,7 @@ class Shapes extends Base
      */
     public static function drawCircleV(Vector2 $center, float $radius, Color $color): void
     {
-        self::ffi()->DrawCircleV($center->struct(), $radius, $color->struct());
+        self::ffi()->DrawCircleV($center->struct(), $radius, $color->cdata());
     }
 
     /**
@@ -239,7 +246,7 @@ class Shapes extends Base
      */
     public static function drawCircleLines(int $centerX, int $centerY, float $radius, Color $color): void
     {
-        self::ffi()->DrawCircleLines($centerX, $centerY, $radius, $color->struct());
+        self::ffi()->DrawCircleLines($centerX, $centerY, $radius, $color->cdata());
     }
 
     /**
@@ -252,7 +259,7 @@ class Shapes extends Base
      */
     public static function drawCircleLinesV(Vector2 $center, float $radius, Color $color): void
     {
-        self::ffi()->DrawCircleLinesV($center->struct(), $radius, $color->struct());
+        self::ffi()->DrawCircleLinesV($center->struct(), $radius, $color->cdata());
     }
 
     /**
@@ -267,7 +274,7 @@ class Shapes extends Base
      */
     public static function drawEllipse(int $centerX, int $centerY, float $radiusH, float $radiusV, Color $color): void
     {
-        self::ffi()->DrawEllipse($centerX, $centerY, $radiusH, $radiusV, $color->struct());
+        self::ffi()->DrawEllipse($centerX, $centerY, $radiusH, $radiusV, $color->cdata());
     }
 
     /**
@@ -282,7 +289,7 @@ class Shapes extends Base
      */
     public static function drawEllipseLines(int $centerX, int $centerY, float $radiusH, float $radiusV, Color $color): void
     {
-        self::ffi()->DrawEllipseLines($centerX, $centerY, $radiusH, $radiusV, $color->struct());
+        self::ffi()->DrawEllipseLines($centerX, $centerY, $radiusH, $radiusV, $color->cdata());
     }
 
     /**
@@ -299,7 +306,7 @@ class Shapes extends Base
      */
     public static function drawRing(Vector2 $center, float $innerRadius, float $outerRadius, float $startAngle, float $endAngle, int $segments, Color $color): void
     {
-        self::ffi()->DrawRing($center->struct(), $innerRadius, $outerRadius, $startAngle, $endAngle, $segments, $color->struct());
+        self::ffi()->DrawRing($center->struct(), $innerRadius, $outerRadius, $startAngle, $endAngle, $segments, $color->cdata());
     }
 
     /**
@@ -316,7 +323,7 @@ class Shapes extends Base
      */
     public static function drawRingLines(Vector2 $center, float $innerRadius, float $outerRadius, float $startAngle, float $endAngle, int $segments, Color $color): void
     {
-        self::ffi()->DrawRingLines($center->struct(), $innerRadius, $outerRadius, $startAngle, $endAngle, $segments, $color->struct());
+        self::ffi()->DrawRingLines($center->struct(), $innerRadius, $outerRadius, $startAngle, $endAngle, $segments, $color->cdata());
     }
 
     /**
@@ -331,7 +338,7 @@ class Shapes extends Base
      */
     public static function drawRectangle(int $posX, int $posY, int $width, int $height, Color $color): void
     {
-        self::ffi()->DrawRectangle($posX, $posY, $width, $height, $color->struct());
+        self::ffi()->DrawRectangle($posX, $posY, $width, $height, $color->cdata());
     }
 
     /**
@@ -344,7 +351,7 @@ class Shapes extends Base
      */
     public static function drawRectangleV(Vector2 $position, Vector2 $size, Color $color): void
     {
-        self::ffi()->DrawRectangleV($position->struct(), $size->struct(), $color->struct());
+        self::ffi()->DrawRectangleV($position->struct(), $size->struct(), $color->cdata());
     }
 
     /**
@@ -356,7 +363,7 @@ class Shapes extends Base
      */
     public static function drawRectangleRec(Rectangle $rec, Color $color): void
     {
-        self::ffi()->DrawRectangleRec($rec->struct(), $color->struct());
+        self::ffi()->DrawRectangleRec($rec->struct(), $color->cdata());
     }
 
     /**
@@ -370,7 +377,7 @@ class Shapes extends Base
      */
     public static function drawRectanglePro(Rectangle $rec, Vector2 $origin, float $rotation, Color $color): void
     {
-        self::ffi()->DrawRectanglePro($rec->struct(), $origin->struct(), $rotation, $color->struct());
+        self::ffi()->DrawRectanglePro($rec->struct(), $origin->struct(), $rotation, $color->cdata());
     }
 
     /**
@@ -386,7 +393,7 @@ class Shapes extends Base
      */
     public static function drawRectangleGradientV(int $posX, int $posY, int $width, int $height, Color $top, Color $bottom): void
     {
-        self::ffi()->DrawRectangleGradientV($posX, $posY, $width, $height, $top->struct(), $bottom->struct());
+        self::ffi()->DrawRectangleGradientV($posX, $posY, $width, $height, $top->cdata(), $bottom->cdata());
     }
 
     /**
@@ -402,7 +409,7 @@ class Shapes extends Base
      */
     public static function drawRectangleGradientH(int $posX, int $posY, int $width, int $height, Color $left, Color $right): void
     {
-        self::ffi()->DrawRectangleGradientH($posX, $posY, $width, $height, $left->struct(), $right->struct());
+        self::ffi()->DrawRectangleGradientH($posX, $posY, $width, $height, $left->cdata(), $right->cdata());
     }
 
     /**
@@ -417,7 +424,7 @@ class Shapes extends Base
      */
     public static function drawRectangleGradientEx(Rectangle $rec, Color $topLeft, Color $bottomLeft, Color $topRight, Color $bottomRight): void
     {
-        self::ffi()->DrawRectangleGradientEx($rec->struct(), $topLeft->struct(), $bottomLeft->struct(), $topRight->struct(), $bottomRight->struct());
+        self::ffi()->DrawRectangleGradientEx($rec->struct(), $topLeft->cdata(), $bottomLeft->cdata(), $topRight->cdata(), $bottomRight->cdata());
     }
 
     /**
@@ -432,7 +439,7 @@ class Shapes extends Base
      */
     public static function drawRectangleLines(int $posX, int $posY, int $width, int $height, Color $color): void
     {
-        self::ffi()->DrawRectangleLines($posX, $posY, $width, $height, $color->struct());
+        self::ffi()->DrawRectangleLines($posX, $posY, $width, $height, $color->cdata());
     }
 
     /**
@@ -445,7 +452,7 @@ class Shapes extends Base
      */
     public static function drawRectangleLinesEx(Rectangle $rec, float $lineThick, Color $color): void
     {
-        self::ffi()->DrawRectangleLinesEx($rec->struct(), $lineThick, $color->struct());
+        self::ffi()->DrawRectangleLinesEx($rec->struct(), $lineThick, $color->cdata());
     }
 
     /**
@@ -459,7 +466,7 @@ class Shapes extends Base
      */
     public static function drawRectangleRounded(Rectangle $rec, float $roundness, int $segments, Color $color): void
     {
-        self::ffi()->DrawRectangleRounded($rec->struct(), $roundness, $segments, $color->struct());
+        self::ffi()->DrawRectangleRounded($rec->struct(), $roundness, $segments, $color->cdata());
     }
 
     /**
@@ -473,7 +480,7 @@ class Shapes extends Base
      */
     public static function drawRectangleRoundedLines(Rectangle $rec, float $roundness, int $segments, Color $color): void
     {
-        self::ffi()->DrawRectangleRoundedLines($rec->struct(), $roundness, $segments, $color->struct());
+        self::ffi()->DrawRectangleRoundedLines($rec->struct(), $roundness, $segments, $color->cdata());
     }
 
     /**
@@ -488,7 +495,70 @@ class Shapes extends Base
      */
     public static function drawRectangleRoundedLinesEx(Rectangle $rec, float $roundness, int $segments, float $lineThick, Color $color): void
     {
-        self::ffi()->DrawRectangleRoundedLinesEx($rec->struct(), $roundness, $segments, $lineThick, $color->struct());
+        self::ffi()->DrawRectangleRoundedLinesEx($rec->struct(), $roundness, $segments, $lineThick, $color->cdata());
+    }
+
+    /**
+     * 打包一条批量矩形记录
+     *
+     * @param float $x X坐标
+     * @param float $y Y坐标
+     * @param float $width 宽度
+     * @param float $height 高度
+     * @param Color $color 颜色
+     * @return string 20 字节的记录，可直接拼接后传给 drawRectanglesBatch()
+     */
+    public static function packRectangle(float $x, float $y, float $width, float $height, Color $color): string
+    {
+        return pack('f4C4', $x, $y, $width, $height, $color->r, $color->g, $color->b, $color->a);
+    }
+
+    /**
+     * 批量绘制实心矩形
+     *
+     * 缓冲区为连续的 x/y/width/height(float) + r/g/b/a(unsigned char) 记录，
+     * 字符串一次 memcpy 进结构体数组后逐条提交，不再创建 Color/Rectangle 对象和临时结构体。
+     *
+     * @param string|CData $buffer 打包的记录（二进制字符串、C 数组或指针）
+     * @param integer|null $count 记录数量，null 时按缓冲区大小计算（指针无法得知大小，必须给出）
+     * @return void
+     * @throws \InvalidArgumentException 如果缓冲区小于记录数量，或传入指针但没有给出记录数量
+     */
+    public static function drawRectanglesBatch(string|CData $buffer, ?int $count = null): void
+    {
+        $ffi = self::ffi();
+        $kind = is_string($buffer) ? null : \FFI::typeof($buffer)->getKind();
+        if ($kind === CType::TYPE_POINTER) {
+            // sizeof 只是指针本身的大小，记录数量由调用方负责
+            if ($count === null) {
+                throw new \InvalidArgumentException("Rectangle record count is required when the buffer is a pointer");
+            }
+            $size = $count * self::RECTANGLE_RECORD_SIZE;
+        } else {
+            $size = is_string($buffer) ? strlen($buffer) : \FFI::sizeof($buffer);
+        }
+        $count ??= intdiv($size, self::RECTANGLE_RECORD_SIZE);
+        if ($count <= 0) {
+            return;
+        }
+        if ($count * self::RECTANGLE_RECORD_SIZE > $size) {
+            throw new \InvalidArgumentException("Buffer holds fewer than " . $count . " rectangle records");
+        }
+
+        if (is_string($buffer)) {
+            self::$rectangleRecord ??= $ffi->type('struct { Rectangle rec; Color color; }');
+            $records = $ffi->new(\FFI::arrayType(self::$rectangleRecord, [$count]));
+            \FFI::memcpy($records, $buffer, $count * self::RECTANGLE_RECORD_SIZE);
+        } else {
+            // 转成记录指针再按下标访问：任意类型的指针都保留地址，数组先取首地址
+            self::$rectangleRecordPointer ??= $ffi->type('struct { Rectangle rec; Color color; } *');
+            $records = $ffi->cast(self::$rectangleRecordPointer, $kind === CType::TYPE_POINTER ? $buffer : \FFI::addr($buffer));
+        }
+
+        for ($i = 0; $i < $count; $i++) {
+            $record = $records[$i];
+            $ffi->DrawRectangleRec($record->rec, $record->color);
+        }
     }
 
     /**
@@ -502,7 +572,7 @@ class Shapes extends Base
      */
     public static function drawTriangle(Vector2 $v1, Vector2 $v2, Vector2 $v3, Color $color): void
     {
-        self::ffi()->DrawTriangle($v1->struct(), $v2->struct(), $v3->struct(), $color->struct());
+        self::ffi()->DrawTriangle($v1->struct(), $v2->struct(), $v3->struct(), $color->cdata());
     }
 
     /**
@@ -516,39 +586,31 @@ class Shapes extends Base
      */
     public static function drawTriangleLines(Vector2 $v1, Vector2 $v2, Vector2 $v3, Color $color): void
     {
-        self::ffi()->DrawTriangleLines($v1->struct(), $v2->struct(), $v3->struct(), $color->struct());
+        self::ffi()->DrawTriangleLines($v1->struct(), $v2->struct(), $v3->struct(), $color->cdata());
     }
 
     /**
      * 绘制三角形扇（第一个顶点为中心）
      *
-     * @param Vector2[] $points 点集
+     * @param Vector2[]|Vector2Buffer $points 点集
      * @param Color $color 颜色
      * @return void
      */
-    public static function drawTriangleFan(array $points, Color $color): void
+    public static function drawTriangleFan(array|Vector2Buffer $points, Color $color): void
     {
-        $c_points = self::ffi()->new('Vector2[' . count($points) . ']');
-        foreach ($points as $i => $point) {
-            $c_points[$i] = $point->struct();
-        }
-        self::ffi()->DrawTriangleFan(self::ffi()->cast('Vector2*', $c_points), count($points), $color->struct());
+        self::ffi()->DrawTriangleFan(self::points($points), count($points), $color->cdata());
     }
 
     /**
      * 绘制三角形带
      *
-     * @param Vector2[] $points 点集
+     * @param Vector2[]|Vector2Buffer $points 点集
      * @param Color $color 颜色
      * @return void
      */
-    public static function drawTriangleStrip(array $points, Color $color): void
+    public static function drawTriangleStrip(array|Vector2Buffer $points, Color $color): void
     {
-        $c_points = self::ffi()->new('Vector2[' . count($points) . ']');
-        foreach ($points as $i => $point) {
-            $c_points[$i] = $point->struct();
-        }
-        self::ffi()->DrawTriangleStrip(self::ffi()->cast('Vector2*', $c_points), count($points), $color->struct());
+        self::ffi()->DrawTriangleStrip(self::points($points), count($points), $color->cdata());
     }
 
     /**
@@ -563,7 +625,7 @@ class Shapes extends Base
      */
     public static function drawPoly(Vector2 $center, int $sides, float $radius, float $rotation, Color $color): void
     {
-        self::ffi()->DrawPoly($center->struct(), $sides, $radius, $rotation, $color->struct());
+        self::ffi()->DrawPoly($center->struct(), $sides, $radius, $rotation, $color->cdata());
     }
 
     /**
@@ -578,7 +640,7 @@ class Shapes extends Base
      */
     public static function drawPolyLines(Vector2 $center, int $sides, float $radius, float $rotation, Color $color): void
     {
-        self::ffi()->DrawPolyLines($center->struct(), $sides, $radius, $rotation, $color->struct());
+        self::ffi()->DrawPolyLines($center->struct(), $sides, $radius, $rotation, $color->cdata());
     }
 
     /**
@@ -594,7 +656,7 @@ class Shapes extends Base
      */
     public static function drawPolyLinesEx(Vector2 $center, int $sides, float $radius, float $rotation, float $lineThick, Color $color): void
     {
-        self::ffi()->DrawPolyLinesEx($center->struct(), $sides, $radius, $rotation, $lineThick, $color->struct());
+        self::ffi()->DrawPolyLinesEx($center->struct(), $sides, $radius, $rotation, $lineThick, $color->cdata());
     }
 
     //### 样条曲线绘制函数
@@ -602,87 +664,69 @@ class Shapes extends Base
     /**
      * 绘制线性样条（至少2个点）
      *
-     * @param Vector2[] $points 点集
-     * @param integer $pointCount 点的数量
+     * @param Vector2[]|Vector2Buffer $points 点集
+     * @param integer $pointCount 点的数量（不能超过点集大小）
      * @param float $thick 粗细
      * @param Color $color 颜色
      * @return void
+     * @throws \OutOfRangeException 如果点的数量超出点集
      */
-    public static function drawSplineLinear(array $points, int $pointCount, float $thick, Color $color): void
+    public static function drawSplineLinear(array|Vector2Buffer $points, int $pointCount, float $thick, Color $color): void
     {
-        $c_points = self::ffi()->new('Vector2[' . count($points) . ']');
-        foreach ($points as $i => $point) {
-            $c_points[$i] = $point->struct();
-        }
-        self::ffi()->DrawSplineLinear(self::ffi()->cast('Vector2*', $c_points), $pointCount, $thick, $color->struct());
+        self::checkPointCount($points, $pointCount);
+        self::ffi()->DrawSplineLinear(self::points($points), $pointCount, $thick, $color->cdata());
     }
 
     /**
      * 绘制B样条曲线（至少4个点）
      *
-     * @param Vector2[] $points 点集
+     * @param Vector2[]|Vector2Buffer $points 点集
      * @param float $thick 粗细
      * @param Color $color 颜色
      * @return void
      */
-    public static function drawSplineBasis(array $points, float $thick, Color $color): void
+    public static function drawSplineBasis(array|Vector2Buffer $points, float $thick, Color $color): void
     {
-        $c_points = self::ffi()->new('Vector2[' . count($points) . ']');
-        foreach ($points as $i => $point) {
-            $c_points[$i] = $point->struct();
-        }
-        self::ffi()->DrawSplineBasis(self::ffi()->cast('Vector2*', $c_points), count($points), $thick, $color->struct());
+        self::ffi()->DrawSplineBasis(self::points($points), count($points), $thick, $color->cdata());
     }
 
     /**
      * 绘制Catmull-Rom样条（至少4个点）
      *
-     * @param Vector2[] $points 点集
+     * @param Vector2[]|Vector2Buffer $points 点集
      * @param float $thick 粗细
      * @param Color $color 颜色
      * @return void
      */
-    public static function drawSplineCatmullRom(array $points, float $thick, Color $color): void
+    public static function drawSplineCatmullRom(array|Vector2Buffer $points, float $thick, Color $color): void
     {
-        $c_points = self::ffi()->new('Vector2[' . count($points) . ']');
-        foreach ($points as $i => $point) {
-            $c_points[$i] = $point->struct();
-        }
-        self::ffi()->DrawSplineCatmullRom(self::ffi()->cast('Vector2*', $c_points), count($points), $thick, $color->struct());
+        self::ffi()->DrawSplineCatmullRom(self::points($points), count($points), $thick, $color->cdata());
     }
 
     /**
      * 绘制二次贝塞尔样条（至少3个点，1个控制点）
      *
-     * @param Vector2[] $points 点集
+     * @param Vector2[]|Vector2Buffer $points 点集
      * @param float $thick 粗细
      * @param Color $color 颜色
      * @return void
      */
-    public static function drawSplineBezierQuadratic(array $points, float $thick, Color $color): void
+    public static function drawSplineBezierQuadratic(array|Vector2Buffer $points, float $thick, Color $color): void
     {
-        $c_points = self::ffi()->new('Vector2[' . count($points) . ']');
-        foreach ($points as $i => $point) {
-            $c_points[$i] = $point->struct();
-        }
-        self::ffi()->DrawSplineBezierQuadratic(self::ffi()->cast('Vector2*', $c_points), count($points), $thick, $color->struct());
+        self::ffi()->DrawSplineBezierQuadratic(self::points($points), count($points), $thick, $color->cdata());
     }
 
     /**
      * 绘制三次贝塞尔样条（至少4个点，2个控制点）
      *
-     * @param Vector2[] $points 点集
+     * @param Vector2[]|Vector2Buffer $points 点集
      * @param float $thick 粗细
      * @param Color $color 颜色
      * @return void
      */
-    public static function drawSplineBezierCubic(array $points, float $thick, Color $color): void
+    public static function drawSplineBezierCubic(array|Vector2Buffer $points, float $thick, Color $color): void
     {
-        $c_points = self::ffi()->new('Vector2[' . count($points) . ']');
-        foreach ($points as $i => $point) {
-            $c_points[$i] = $point->struct();
-        }
-        self::ffi()->DrawSplineBezierCubic(self::ffi()->cast('Vector2*', $c_points), count($points), $thick, $color->struct());
+        self::ffi()->DrawSplineBezierCubic(self::points($points), count($points), $thick, $color->cdata());
     }
 
     /**
@@ -696,7 +740,7 @@ class Shapes extends Base
      */
     public static function drawSplineSegmentLinear(Vector2 $p1, Vector2 $p2, float $thick, Color $color): void
     {
-        self::ffi()->DrawSplineSegmentLinear($p1->struct(), $p2->struct(), $thick, $color->struct());
+        self::ffi()->DrawSplineSegmentLinear($p1->struct(), $p2->struct(), $thick, $color->cdata());
     }
 
     /**
@@ -712,7 +756,7 @@ class Shapes extends Base
      */
     public static function drawSplineSegmentBasis(Vector2 $p1, Vector2 $p2, Vector2 $p3, Vector2 $p4, float $thick, Color $color): void
     {
-        self::ffi()->DrawSplineSegmentBasis($p1->struct(), $p2->struct(), $p3->struct(), $p4->struct(), $thick, $color->struct());
+        self::ffi()->DrawSplineSegmentBasis($p1->struct(), $p2->struct(), $p3->struct(), $p4->struct(), $thick, $color->cdata());
     }
 
     /**
@@ -728,7 +772,7 @@ class Shapes extends Base
      */
     public static function drawSplineSegmentCatmullRom(Vector2 $p1, Vector2 $p2, Vector2 $p3, Vector2 $p4, float $thick, Color $color): void
     {
-        self::ffi()->DrawSplineSegmentCatmullRom($p1->struct(), $p2->struct(), $p3->struct(), $p4->struct(), $thick, $color->struct());
+        self::ffi()->DrawSplineSegmentCatmullRom($p1->struct(), $p2->struct(), $p3->struct(), $p4->struct(), $thick, $color->cdata());
     }
 
     /**
@@ -743,7 +787,7 @@ class Shapes extends Base
      */
     public static function drawSplineSegmentBezierQuadratic(Vector2 $p1, Vector2 $c2, Vector2 $p3, float $thick, Color $color): void
     {
-        self::ffi()->DrawSplineSegmentBezierQuadratic($p1->struct(), $c2->struct(), $p3->struct(), $thick, $color->struct());
+        self::ffi()->DrawSplineSegmentBezierQuadratic($p1->struct(), $c2->struct(), $p3->struct(), $thick, $color->cdata());
     }
 
     /**
@@ -759,7 +803,7 @@ class Shapes extends Base
      */
     public static function drawSplineSegmentBezierCubic(Vector2 $p1, Vector2 $c2, Vector2 $c3, Vector2 $p4, float $thick, Color $color): void
     {
-        self::ffi()->DrawSplineSegmentBezierCubic($p1->struct(), $c2->struct(), $c3->struct(), $p4->struct(), $thick, $color->struct());
+        self::ffi()->DrawSplineSegmentBezierCubic($p1->struct(), $c2->struct(), $c3->struct(), $p4->struct(), $thick, $color->cdata());
     }
 
     //### 样条曲线点插值计算函数（t范围[0.0f, 1.0f]）
@@ -988,4 +1032,39 @@ class Shapes extends Base
         $res = self::ffi()->GetCollisionRec($rec1->struct(), $rec2->struct());
         return new Rectangle($res->x, $res->y, $res->width, $res->height);
     }
+
+    /**
+     * 检查传给 raylib 的点数量，超出点集会越界读取
+     *
+     * @param Vector2[]|Vector2Buffer $points 点集
+     * @param integer $pointCount 点的数量
+     * @return void
+     * @throws \OutOfRangeException 如果点的数量为负数或超过点集大小
+     */
+    private static function checkPointCount(array|Vector2Buffer $points, int $pointCount): void
+    {
+        if ($pointCount < 0 || $pointCount > count($points)) {
+            throw new \OutOfRangeException("Point count " . $pointCount . " is out of range 0.." . count($points));
+        }
+    }
+
+    /**
+     * 点集转为 Vector2 数组（可直接传给 Vector2* 参数）
+     *
+     * Vector2Buffer 直接返回已有的数组，Vector2[] 才需要构建新数组
+     *
+     * @param Vector2[]|Vector2Buffer $points 点集
+     * @return CData
+     */
+    private static function points(array|Vector2Buffer $points): CData
+    {
+        if ($points instanceof Vector2Buffer) {
+            return $points->struct();
+        }
+        $c_points = self::ffi()->new('Vector2[' . count($points) . ']');
+        foreach ($points as $i => $point) {
+            $c_points[$i] = $point->struct();
+        }
+        return $c_points;
+    }
 }
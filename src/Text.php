@@ -5,10 +5,13 @@ declare(strict_types=1);
 namespace Kingbes\Raylib;
 
 use Kingbes\Raylib\Utils\Font;
+use Kingbes\Raylib\Utils\CodepointSet;
+use Kingbes\Raylib\Utils\DynamicFont;
 use Kingbes\Raylib\Utils\Image;
 use Kingbes\Raylib\Utils\Color;
 use Kingbes\Raylib\Utils\GlyphInfo;
 use Kingbes\Raylib\Utils\Rectangle;
+use Kingbes\Raylib\Utils\TextLayout;
 use Kingbes\Raylib\Utils\Vector2;
 
 /**
@@ -16,6 +19,12 @@ use Kingbes\Raylib\Utils\Vector2;
  */
 class Text extends Base
 {
+    // 头文件模块
+    protected const MODULE = 'text';
+
+    // 换行行间距（与 raylib 内部的 textLineSpacing 同步）
+    private static int $lineSpacing = 2;
+
     //### 字体加载/卸载函数
 
     /**
@@ -40,35 +49,43 @@ class Text extends Base
     }
 
     /**
-     * 扩展参数加载字体（codepoints传NULL且codepointCount为0时加载默认字符集，字号单位为像素高度）
+     * 扩展参数加载字体（codepoints传NULL时加载默认字符集，字号单位为像素高度）
+     *
+     * 只光栅化码位集合中的字符，CJK 字体请传入实际用到的文本或区块，
+     * 不要加载整个 Unicode 范围。
      *
      * @param string $fileName 文件名
      * @param int $fontSize 字体大小
+     * @param CodepointSet|null $codepoints 码位集合，null 为默认字符集（ASCII）
+     * @param array|null &$report 加载报告：time（秒）、glyphCount、atlasWidth、atlasHeight、atlasBytes
      * @return Font 返回Font对象
+     * @throws \Exception 如果字体加载失败
      */
     public static function loadFontEx(
         string $fileName,
-        int $fontSize
+        int $fontSize,
+        ?CodepointSet $codepoints = null,
+        ?array &$report = null
     ): Font {
-        $c_codepoints = self::ffi()->new("int[1000000]", false);
-
-        for($i = 0; $i < 1000000; $i++){
-            $c_codepoints[$i] = $i;
-        }
-        
-        $cc_codepoints = self::ffi()->cast("int*", $c_codepoints);
+        $start = hrtime(true);
         $res = new Font(self::ffi()->LoadFontEx(
             $fileName,
             $fontSize,
-            $cc_codepoints,
-            1000000
+            $codepoints?->struct(),
+            $codepoints === null ? 0 : count($codepoints)
         ));
         if (self::isFontValid($res) == false) {
             // 如果字体加载失败，抛出异常
             throw new \Exception("无法加载字体，请检查路径是否正确！");
         }
-        unset($c_codepoints);
-        unset($cc_codepoints);
+        $texture = $res->struct()->texture;
+        $report = [
+            'time' => (hrtime(true) - $start) / 1e9,
+            'glyphCount' => $res->glyphCount,
+            'atlasWidth' => $texture->width,
+            'atlasHeight' => $texture->height,
+            'atlasBytes' => $res->atlasBytes(),
+        ];
         return $res;
     }
 
@@ -82,7 +99,7 @@ class Text extends Base
      */
     public static function loadFontFromImage(Image $image, Color $key, int $firstChar): Font
     {
-        return new Font(self::ffi()->LoadFontFromImage($image->struct(), $key->struct(), $firstChar));
+        return new Font(self::ffi()->LoadFontFromImage($image->struct(), $key->cdata(), $firstChar));
     }
 
     /**
@@ -236,13 +253,13 @@ class Text extends Base
      */
     public static function drawText(string $text, int $posX, int $posY, int $fontSize, Color $color): void
     {
-        self::ffi()->DrawText($text, $posX, $posY, $fontSize, $color->struct());
+        self::ffi()->DrawText($text, $posX, $posY, $fontSize, $color->cdata());
     }
 
     /**
      * 使用字体和额外参数绘制文本
      *
-     * @param Font $font Font对象
+     * @param Font|DynamicFont $font Font对象或动态字体（缺失的字形首次绘制时光栅化）
      * @param string $text 文本内容
      * @param Vector2 $position Vector2对象
      * @param float $fontSize 字体大小
@@ -250,9 +267,40 @@ class Text extends Base
      * @param Color $tint 颜色
      * @return void
      */
-    public static function drawTextEx(Font $font, string $text, Vector2 $position, float $fontSize, float $spacing, Color $tint): void
+    public static function drawTextEx(Font|DynamicFont $font, string $text, Vector2 $position, float $fontSize, float $spacing, Color $tint): void
+    {
+        if ($font instanceof DynamicFont) {
+            $font->draw($text, $position, $fontSize, $spacing, $tint);
+            return;
+        }
+        self::ffi()->DrawTextEx($font->struct(), $text, $position->struct(), $fontSize, $spacing, $tint->cdata());
+    }
+
+    /**
+     * 创建文本排版缓存，多次绘制同一文本时只排版一次（需要时调用，drawTextEx() 不会自动使用）
+     *
+     * @param Font $font Font对象
+     * @param string $text 文本内容
+     * @param float $fontSize 字体大小
+     * @param float $spacing 字间距
+     * @return TextLayout 返回TextLayout对象
+     */
+    public static function layoutText(Font $font, string $text, float $fontSize, float $spacing): TextLayout
+    {
+        return (new TextLayout($font, $text, $fontSize, $spacing))->setLineSpacing(self::$lineSpacing);
+    }
+
+    /**
+     * 绘制排版缓存的文本
+     *
+     * @param TextLayout $layout TextLayout对象
+     * @param Vector2 $position Vector2对象
+     * @param Color $tint 颜色
+     * @return void
+     */
+    public static function drawTextLayout(TextLayout $layout, Vector2 $position, Color $tint): void
     {
-        self::ffi()->DrawTextEx($font->struct(), $text, $position->struct(), $fontSize, $spacing, $tint->struct());
+        $layout->draw($position, $tint);
     }
 
     /**
@@ -270,7 +318,7 @@ class Text extends Base
      */
     public static function drawTextPro(Font $font, string $text, Vector2 $position, Vector2 $origin, float $rotation, float $fontSize, float $spacing, Color $tint): void
     {
-        self::ffi()->DrawTextPro($font->struct(), $text, $position->struct(), $origin->struct(), $rotation, $fontSize, $spacing, $tint->struct());
+        self::ffi()->DrawTextPro($font->struct(), $text, $position->struct(), $origin->struct(), $rotation, $fontSize, $spacing, $tint->cdata());
     }
 
     /**
@@ -285,7 +333,7 @@ class Text extends Base
      */
     public static function drawTextCodepoint(Font $font, int $codepoint, Vector2 $position, float $fontSize, Color $tint): void
     {
-        self::ffi()->DrawTextCodepoint($font->struct(), $codepoint, $position->struct(), $fontSize, $tint->struct());
+        self::ffi()->DrawTextCodepoint($font->struct(), $codepoint, $position->struct(), $fontSize, $tint->cdata());
     }
 
     /**
@@ -307,7 +355,7 @@ class Text extends Base
         foreach ($codepoints as $i => $cp) {
             $cCodepoints[$i] = $cp;
         }
-        self::ffi()->DrawTextCodepoints($font->struct(), $cCodepoints, $codepointCount, $position->struct(), $fontSize, $spacing, $tint->struct());
+        self::ffi()->DrawTextCodepoints($font->struct(), $cCodepoints, $codepointCount, $position->struct(), $fontSize, $spacing, $tint->cdata());
     }
 
     //### 字体信息函数
@@ -321,6 +369,7 @@ class Text extends Base
     public static function setTextLineSpacing(int $spacing): void
     {
         self::ffi()->SetTextLineSpacing($spacing);
+        self::$lineSpacing = $spacing;
     }
 
     /**
@@ -338,14 +387,17 @@ class Text extends Base
     /**
      * 测量指定字体文本尺寸
      *
-     * @param \FFI\CData $font Font对象
+     * @param Font|DynamicFont $font Font对象或动态字体
      * @param string $text 文本内容
      * @param float $fontSize 字体大小
      * @param float $spacing 字间距
-     * @return \FFI\CData 返回Vector2对象
+     * @return Vector2 返回Vector2对象
      */
-    public static function measureTextEx(Font $font, string $text, float $fontSize, float $spacing): Vector2
+    public static function measureTextEx(Font|DynamicFont $font, string $text, float $fontSize, float $spacing): Vector2
     {
+        if ($font instanceof DynamicFont) {
+            return $font->measure($text, $fontSize, $spacing);
+        }
         $res = self::ffi()->MeasureTextEx($font->struct(), $text, $fontSize, $spacing);
         return new Vector2($res->x, $res->y);
     }
@@ -359,7 +411,7 @@ class Text extends Base
      */
     public static function getGlyphIndex(Font $font, int $codepoint): int
     {
-        return self::ffi()->GetGlyphIndex($font->struct(), $codepoint);
+        return $font->glyphIndex($codepoint);
     }
 
     /**
@@ -371,7 +423,7 @@ class Text extends Base
      */
     public static function getGlyphInfo(Font $font, int $codepoint): GlyphInfo
     {
-        return new GlyphInfo(self::ffi()->GetGlyphInfo($font->struct(), $codepoint));
+        return new GlyphInfo(clone $font->struct()->glyphs[$font->glyphIndex($codepoint)]);
     }
 
     /**
@@ -383,7 +435,7 @@ class Text extends Base
      */
     public static function getGlyphAtlasRec(Font $font, int $codepoint): Rectangle
     {
-        $res = self::ffi()->GetGlyphAtlasRec($font->struct(), $codepoint);
+        $res = $font->struct()->recs[$font->glyphIndex($codepoint)];
         return new Rectangle($res->x, $res->y, $res->width, $res->height);
     }
 
@@ -448,6 +500,27 @@ class Text extends Base
         self::ffi()->UnloadCodepoints($codepoints);
     }
 
+    /**
+     * UTF-8 文本解码为码位数组（LoadCodepoints 后一次复制并立即卸载，无效字节解码为'?'）
+     *
+     * @param string $text UTF-8文本
+     * @return array<int> 码位数组
+     */
+    public static function codepoints(string $text): array
+    {
+        if ($text === '') {
+            return [];
+        }
+        $ffi = self::ffi();
+        $count = $ffi->new('int');
+        $data = $ffi->LoadCodepoints($text, \FFI::addr($count));
+        try {
+            return $count->cdata > 0 ? array_values(unpack('l*', \FFI::string($data, $count->cdata * 4))) : [];
+        } finally {
+            $ffi->UnloadCodepoints($data);
+        }
+    }
+
     /**
      * 获取UTF-8文本的码位总数
      *
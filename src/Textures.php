@@ -5,6 +5,11 @@ declare(strict_types=1);
 namespace Kingbes\Raylib;
 
 use Kingbes\Raylib\Utils\Image;
+use Kingbes\Raylib\Utils\ImageDrawList;
+use Kingbes\Raylib\Utils\ImageWorkerPool;
+use Kingbes\Raylib\Utils\LibC;
+use Kingbes\Raylib\Utils\MappedImage;
+use Kingbes\Raylib\Utils\PixelView;
 use Kingbes\Raylib\Utils\Rectangle;
 use Kingbes\Raylib\Utils\Color;
 use Kingbes\Raylib\Utils\Vector2;
@@ -12,12 +17,22 @@ use Kingbes\Raylib\Utils\Texture;
 use Kingbes\Raylib\Utils\RenderTexture;
 use Kingbes\Raylib\Utils\NPatchInfo;
 use Kingbes\Raylib\Utils\Font;
+use \FFI\CData;
 
 /**
  * Textures类
  */
 class Textures extends Base
 {
+    // 头文件模块
+    protected const MODULE = 'textures';
+
+    // 并行处理的最小像素数，小图像 fork 子进程的开销超过收益
+    public const PARALLEL_MIN_PIXELS = 512 * 512;
+
+    // 图像处理的并行进程数，1 表示在当前进程处理
+    private static int $imageWorkers = 1;
+
     //### 图像加载函数
     //> 注意：这些函数不需要GPU访问
 
@@ -48,6 +63,53 @@ class Textures extends Base
         return new Image(self::ffi()->LoadImageRaw($fileName, $width, $height, $format, $headerSize));
     }
 
+    /**
+     * 映射RAW文件加载图像，像素不读入堆内存
+     *
+     * 用于超大的未压缩像素文件，只读访问不复制，原地修改前自动复制到 raylib 内存。
+     * 必须用 unloadImage() 释放。
+     *
+     * @param string $fileName 文件名
+     * @param int $width 宽度
+     * @param int $height 高度
+     * @param int $format 格式（仅未压缩格式）
+     * @param int $headerSize 头部大小
+     * @return MappedImage 返回MappedImage对象
+     */
+    public static function loadImageRawMapped(string $fileName, int $width, int $height, int $format, int $headerSize = 0): MappedImage
+    {
+        return MappedImage::open($fileName, $width, $height, $format, $headerSize);
+    }
+
+    /**
+     * 映射文件后解码图像，省去 loadImage() 读入整个文件的堆缓冲区
+     *
+     * 解码后的像素仍由 raylib 分配，峰值内存约为像素数据大小。系统不支持映射时退回 loadImage()。
+     *
+     * @param string $fileName 文件名
+     * @return Image 返回Image对象
+     */
+    public static function loadImageMapped(string $fileName): Image
+    {
+        $libc = LibC::get();
+        $size = @filesize($fileName);
+        $fd = $libc === null || !$size ? -1 : $libc->open($fileName, LibC::O_RDONLY);
+        if ($fd < 0) {
+            return self::loadImage($fileName);
+        }
+        $mapping = $libc->mmap(null, $size, LibC::PROT_READ, LibC::MAP_PRIVATE, $fd, 0);
+        $libc->close($fd);
+        if (LibC::mapFailed($mapping)) {
+            return self::loadImage($fileName);
+        }
+        try {
+            $fileType = '.' . strtolower(pathinfo($fileName, PATHINFO_EXTENSION));
+            return new Image(self::ffi()->LoadImageFromMemory($fileType, self::ffi()->cast('unsigned char *', $mapping), $size));
+        } finally {
+            $libc->munmap($mapping, $size);
+        }
+    }
+
     /**
      * 从文件加载图像序列(帧数据追加到image.data)
      *
@@ -141,7 +203,13 @@ class Textures extends Base
      */
     public static function unloadImage(Image $image): void
     {
+        if ($image instanceof MappedImage) {
+            $image->unload();
+            return;
+        }
         self::ffi()->UnloadImage($image->struct());
+        // 清空指针，像素视图据此发现图像已卸载
+        $image->struct()->data = null;
     }
 
     /**
@@ -159,19 +227,83 @@ class Textures extends Base
     /**
      * 导出图像到内存缓冲区
      *
+     * 编码结果一次复制为 PHP 字符串，raylib 分配的缓冲区随即释放。需要解析 core 模块（MemFree）。
+     *
      * @param Image $image Image对象
-     * @param string $fileType 文件类型
+     * @param string $fileType 文件类型（如 '.png'）
      * @param int &$fileSize 文件大小引用
-     * @return string 返回导出的数据
+     * @return string 返回导出的数据，失败返回空字符串
      */
     public static function exportImageToMemory(Image $image, string $fileType, int &$fileSize): string
     {
-        $c_fileSize = self::ffi()->new('int[1]');
-        $c_fileSize[0] = $fileSize;
-        $cc_fileSize = self::ffi()->cast('int *', $c_fileSize);
-        $res = self::ffi()->ExportImageToMemory($image->struct(), $fileType, $cc_fileSize);
-        $fileSize = $cc_fileSize[0];
-        return $res;
+        // 缓冲区用 core 模块的 MemFree() 释放，先检查模块已解析，避免编码后无法释放
+        $core = Core::ffi();
+        $c_fileSize = self::ffi()->new('int');
+        $res = self::ffi()->ExportImageToMemory($image->struct(), $fileType, \FFI::addr($c_fileSize));
+        $fileSize = $c_fileSize->cdata;
+        if (\FFI::isNull($res)) {
+            $fileSize = 0;
+            return '';
+        }
+        try {
+            return \FFI::string($res, $fileSize);
+        } finally {
+            $core->MemFree($res);
+        }
+    }
+
+    /**
+     * 分块导出图像数据
+     *
+     * 编码后按块生成字符串，不会在 PHP 中拼出完整文件，适合直接写入响应或文件流。
+     * 遍历结束或生成器被销毁时释放 raylib 的缓冲区。需要解析 core 模块（MemFree）。
+     *
+     * @param Image $image Image对象
+     * @param string $fileType 文件类型（如 '.png'）
+     * @param int $chunkSize 每块字节数
+     * @return \Generator<int, string> 数据块
+     * @throws \RuntimeException 如果编码失败
+     */
+    public static function exportImageChunks(Image $image, string $fileType, int $chunkSize = 1048576): \Generator
+    {
+        $core = Core::ffi();
+        $c_fileSize = self::ffi()->new('int');
+        $res = self::ffi()->ExportImageToMemory($image->struct(), $fileType, \FFI::addr($c_fileSize));
+        if (\FFI::isNull($res)) {
+            throw new \RuntimeException("Failed to export image as " . $fileType);
+        }
+        try {
+            $bytes = self::ffi()->cast('unsigned char *', $res);
+            $fileSize = $c_fileSize->cdata;
+            $chunkSize = max(1, $chunkSize);
+            for ($offset = 0; $offset < $fileSize; $offset += $chunkSize) {
+                yield \FFI::string($bytes + $offset, min($chunkSize, $fileSize - $offset));
+            }
+        } finally {
+            $core->MemFree($res);
+        }
+    }
+
+    /**
+     * 分块导出图像数据到流
+     *
+     * @param Image $image Image对象
+     * @param string $fileType 文件类型（如 '.png'）
+     * @param resource $stream 可写的流（文件、php://output 等）
+     * @param int $chunkSize 每块字节数
+     * @return int 写入的字节数
+     * @throws \RuntimeException 如果编码或写入失败
+     */
+    public static function exportImageToStream(Image $image, string $fileType, $stream, int $chunkSize = 1048576): int
+    {
+        $written = 0;
+        foreach (self::exportImageChunks($image, $fileType, $chunkSize) as $chunk) {
+            if (fwrite($stream, $chunk) !== strlen($chunk)) {
+                throw new \RuntimeException("Failed to write exported image to stream");
+            }
+            $written += strlen($chunk);
+        }
+        return $written;
     }
 
     /**
@@ -198,7 +330,7 @@ class Textures extends Base
      */
     public static function genImageColor(int $width, int $height, Color $color): Image
     {
-        return new Image(self::ffi()->GenImageColor($width, $height, $color->struct()));
+        return new Image(self::ffi()->GenImageColor($width, $height, $color->cdata()));
     }
 
     /**
@@ -213,7 +345,7 @@ class Textures extends Base
      */
     public static function genImageGradientLinear(int $width, int $height, int $direction, Color $start, Color $end): Image
     {
-        return new Image(self::ffi()->GenImageGradientLinear($width, $height, $direction, $start->struct(), $end->struct()));
+        return new Image(self::ffi()->GenImageGradientLinear($width, $height, $direction, $start->cdata(), $end->cdata()));
     }
 
     /**
@@ -228,7 +360,7 @@ class Textures extends Base
      */
     public static function genImageGradientRadial(int $width, int $height, float $density, Color $inner, Color $outer): Image
     {
-        return new Image(self::ffi()->GenImageGradientRadial($width, $height, $density, $inner->struct(), $outer->struct()));
+        return new Image(self::ffi()->GenImageGradientRadial($width, $height, $density, $inner->cdata(), $outer->cdata()));
     }
 
     /**
@@ -243,7 +375,7 @@ class Textures extends Base
      */
     public static function genImageGradientSquare(int $width, int $height, float $density, Color $inner, Color $outer): Image
     {
-        return new Image(self::ffi()->GenImageGradientSquare($width, $height, $density, $inner->struct(), $outer->struct()));
+        return new Image(self::ffi()->GenImageGradientSquare($width, $height, $density, $inner->cdata(), $outer->cdata()));
     }
 
     /**
@@ -259,7 +391,7 @@ class Textures extends Base
      */
     public static function genImageChecked(int $width, int $height, int $checksX, int $checksY, Color $col1, Color $col2): Image
     {
-        return new Image(self::ffi()->GenImageChecked($width, $height, $checksX, $checksY, $col1->struct(), $col2->struct()));
+        return new Image(self::ffi()->GenImageChecked($width, $height, $checksX, $checksY, $col1->cdata(), $col2->cdata()));
     }
 
     /**
@@ -363,7 +495,7 @@ class Textures extends Base
      */
     public static function imageText(string $text, int $fontSize, Color $color): Image
     {
-        return new Image(self::ffi()->ImageText($text, $fontSize, $color->struct()));
+        return new Image(self::ffi()->ImageText($text, $fontSize, $color->cdata()));
     }
 
     /**
@@ -378,178 +510,193 @@ class Textures extends Base
      */
     public static function imageTextEx(Font $font, string $text, float $fontSize, float $spacing, Color $tint): Image
     {
-        return new Image(self::ffi()->ImageTextEx($font->struct(), $text, $fontSize, $spacing, $tint->struct()));
+        return new Image(self::ffi()->ImageTextEx($font->struct(), $text, $fontSize, $spacing, $tint->cdata()));
+    }
+
+    /**
+     * 设置图像处理的并行进程数
+     *
+     * 大于 1 时，卷积和逐像素颜色运算（imageKernelConvolution、imageColorGrayscale、imageColorContrast、
+     * imageColorInvert、imageColorBrightness、imageColorTint）把图像按行分块交给 pcntl_fork() 的子进程处理，
+     * 结果与在当前进程处理完全相同。需要 pcntl 扩展，不支持时自动在当前进程处理。
+     * imageResize 和 imageBlurGaussian 的结果依赖整幅图像的累加顺序，分块后会有差异，始终在当前进程执行。
+     *
+     * 只适合 InitWindow()/InitAudioDevice() 之前的离线处理（资源构建、批量转换）：
+     * 它们启动的驱动和音频线程不会被 fork 复制，子进程可能死锁，初始化之后不再 fork。
+     *
+     * @param int $workers 进程数
+     * @return void
+     */
+    public static function setImageWorkers(int $workers): void
+    {
+        self::$imageWorkers = max(1, $workers);
+    }
+
+    /**
+     * 获取图像处理的并行进程数
+     *
+     * @return int 进程数
+     */
+    public static function getImageWorkers(): int
+    {
+        return self::$imageWorkers;
     }
 
     /**
      * 转换图像数据到指定格式
      *
-     * @param Image $image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param int $newFormat 新格式
      * @return void
      */
     public static function imageFormat(Image $image, int $newFormat): void
     {
-        self::ffi()->ImageFormat($image->struct(), $newFormat);
+        self::ffi()->ImageFormat($image->pointer(), $newFormat);
     }
 
     /**
      * 将图像转换为2的幂次方尺寸(用颜色填充)
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param Color $fill 填充颜色
      * @return void
      */
-    public static function imageToPOT(Image &$image, Color $fill): void
+    public static function imageToPOT(Image $image, Color $fill): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageToPOT($c_image, $fill->struct());
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageToPOT($image->pointer(), $fill->cdata());
     }
 
     /**
      * 按矩形区域裁剪图像
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param Rectangle $crop 矩形裁剪区域
      * @return void
      */
-    public static function imageCrop(Image &$image, Rectangle $crop): void
+    public static function imageCrop(Image $image, Rectangle $crop): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageCrop($c_image, $crop->struct());
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageCrop($image->pointer(), $crop->struct());
     }
 
     /**
      * 根据alpha通道阈值裁剪图像
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param float $threshold 阈值
      * @return void
      */
-    public static function imageAlphaCrop(Image &$image, float $threshold): void
+    public static function imageAlphaCrop(Image $image, float $threshold): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageAlphaCrop($c_image, $threshold);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageAlphaCrop($image->pointer(), $threshold);
     }
 
     /**
      * 用指定颜色替换低于阈值的alpha区域
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param Color $color 颜色
      * @param float $threshold 阈值
      * @return void
      */
-    public static function imageAlphaClear(Image &$image, Color $color, float $threshold): void
+    public static function imageAlphaClear(Image $image, Color $color, float $threshold): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageAlphaClear($c_image, $color->struct(), $threshold);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageAlphaClear($image->pointer(), $color->cdata(), $threshold);
     }
 
     /**
      * 应用alpha遮罩到图像
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param Image $alphaMask Alpha遮罩图像
      * @return void
      */
-    public static function imageAlphaMask(Image &$image, Image $alphaMask): void
+    public static function imageAlphaMask(Image $image, Image $alphaMask): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageAlphaMask($c_image, $alphaMask->struct());
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageAlphaMask($image->pointer(), $alphaMask->struct());
     }
 
     /**
      * 预乘alpha通道
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @return void
      */
-    public static function imageAlphaPremultiply(Image &$image): void
+    public static function imageAlphaPremultiply(Image $image): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageAlphaPremultiply($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageAlphaPremultiply($image->pointer());
     }
 
     /**
      * 应用高斯模糊(基于盒模糊近似)
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param int $blurSize 模糊大小
      * @return void
      */
-    public static function imageBlurGaussian(Image &$image, int $blurSize): void
+    public static function imageBlurGaussian(Image $image, int $blurSize): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageBlurGaussian($c_image, $blurSize);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageBlurGaussian($image->pointer(), $blurSize);
     }
 
     /**
      * 应用自定义卷积核处理图像
      *
-     * @param Image &$image Image对象引用
-     * @param string $kernel 卷积核
-     * @param int $kernelSize 卷积核大小
+     * @param Image $image Image对象（原地修改）
+     * @param string|array<float> $kernel 卷积核（pack('g*') 打包的 float 或 float 数组）
+     * @param int $kernelSize 卷积核元素数量（如 3x3 为 9），不能超过卷积核的元素数
      * @return void
+     * @throws \InvalidArgumentException 如果卷积核数据不是整数个 float，或元素数量少于 $kernelSize
      */
-    public static function imageKernelConvolution(Image &$image, string $kernel, int $kernelSize): void
+    public static function imageKernelConvolution(Image $image, string|array $kernel, int $kernelSize): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageKernelConvolution($c_image, $kernel, $kernelSize);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        // const float * 参数不接受 PHP 字符串，统一复制进 float 数组
+        $data = is_array($kernel) ? pack('g*', ...array_values($kernel)) : $kernel;
+        if (strlen($data) % 4 !== 0) {
+            throw new \InvalidArgumentException("Kernel data must be a whole number of floats, got " . strlen($data) . " bytes");
+        }
+        $count = intdiv(strlen($data), 4);
+        if ($kernelSize <= 0 || $kernelSize > $count) {
+            throw new \InvalidArgumentException("Kernel size " . $kernelSize . " is out of range 1.." . $count);
+        }
+        $kernel = self::ffi()->new('float[' . $count . ']');
+        \FFI::memcpy($kernel, $data, strlen($data));
+        self::process(
+            $image,
+            intdiv((int)sqrt($kernelSize), 2),
+            fn(Image $tile) => self::ffi()->ImageKernelConvolution($tile->pointer(), $kernel, $kernelSize)
+        );
     }
 
     /**
      * 调整图像尺寸(双三次插值算法)
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param int $newWidth 新宽度
      * @param int $newHeight 新高度
      * @return void
      */
-    public static function imageResize(Image &$image, int $newWidth, int $newHeight): void
+    public static function imageResize(Image $image, int $newWidth, int $newHeight): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageResize($c_image, $newWidth, $newHeight);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageResize($image->pointer(), $newWidth, $newHeight);
     }
 
     /**
      * 调整图像尺寸(最近邻插值算法)
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param int $newWidth 新宽度
      * @param int $newHeight 新高度
      * @return void
      */
-    public static function imageResizeNN(Image &$image, int $newWidth, int $newHeight): void
+    public static function imageResizeNN(Image $image, int $newWidth, int $newHeight): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageResizeNN($c_image, $newWidth, $newHeight);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageResizeNN($image->pointer(), $newWidth, $newHeight);
     }
 
     /**
      * 调整画布尺寸并用颜色填充
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param int $newWidth 新宽度
      * @param int $newHeight 新高度
      * @param int $offsetX X轴偏移
@@ -557,219 +704,187 @@ class Textures extends Base
      * @param Color $fill 填充颜色
      * @return void
      */
-    public static function imageResizeCanvas(Image &$image, int $newWidth, int $newHeight, int $offsetX, int $offsetY, Color $fill): void
+    public static function imageResizeCanvas(Image $image, int $newWidth, int $newHeight, int $offsetX, int $offsetY, Color $fill): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageResizeCanvas($c_image, $newWidth, $newHeight, $offsetX, $offsetY, $fill->struct());
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageResizeCanvas($image->pointer(), $newWidth, $newHeight, $offsetX, $offsetY, $fill->cdata());
     }
 
     /**
      * 生成图像多级渐远纹理
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @return void
      */
-    public static function imageMipmaps(Image &$image): void
+    public static function imageMipmaps(Image $image): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageMipmaps($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageMipmaps($image->pointer());
     }
 
     /**
      * 将图像颜色深度降低至16位或更低(弗洛伊德-斯坦伯格抖动)
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param int $rBpp 红色位深度
      * @param int $gBpp 绿色位深度
      * @param int $bBpp 蓝色位深度
      * @param int $aBpp Alpha位深度
      * @return void
      */
-    public static function imageDither(Image &$image, int $rBpp, int $gBpp, int $bBpp, int $aBpp): void
+    public static function imageDither(Image $image, int $rBpp, int $gBpp, int $bBpp, int $aBpp): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageDither($c_image, $rBpp, $gBpp, $bBpp, $aBpp);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageDither($image->pointer(), $rBpp, $gBpp, $bBpp, $aBpp);
     }
 
     /**
      * 垂直翻转图像
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @return void
      */
-    public static function imageFlipVertical(Image &$image): void
+    public static function imageFlipVertical(Image $image): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageFlipVertical($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageFlipVertical($image->pointer());
     }
 
     /**
      * 水平翻转图像
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @return void
      */
-    public static function imageFlipHorizontal(Image &$image): void
+    public static function imageFlipHorizontal(Image $image): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageFlipHorizontal($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageFlipHorizontal($image->pointer());
     }
 
     /**
      * 旋转图像(-359到359度)
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param int $degrees 旋转角度
      * @return void
      */
-    public static function imageRotate(Image &$image, int $degrees): void
+    public static function imageRotate(Image $image, int $degrees): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageRotate($c_image, $degrees);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageRotate($image->pointer(), $degrees);
     }
 
     /**
      * 顺时针旋转90度
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @return void
      */
-    public static function imageRotateCW(Image &$image): void
+    public static function imageRotateCW(Image $image): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageRotateCW($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageRotateCW($image->pointer());
     }
 
     /**
      * 逆时针旋转90度
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @return void
      */
-    public static function imageRotateCCW(Image &$image): void
+    public static function imageRotateCCW(Image $image): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageRotateCCW($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageRotateCCW($image->pointer());
     }
 
     /**
      * 给图像着色
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageColorTint(Image &$image, Color $color): void
+    public static function imageColorTint(Image $image, Color $color): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageColorTint($c_image, $color->struct());
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::process($image, 0, fn(Image $tile) => self::ffi()->ImageColorTint($tile->pointer(), $color->cdata()));
     }
 
     /**
      * 反相图像颜色
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @return void
      */
-    public static function imageColorInvert(Image &$image): void
+    public static function imageColorInvert(Image $image): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageColorInvert($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::process($image, 0, fn(Image $tile) => self::ffi()->ImageColorInvert($tile->pointer()));
     }
 
     /**
      * 将图像转为灰度
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @return void
      */
-    public static function imageColorGrayscale(Image &$image): void
+    public static function imageColorGrayscale(Image $image): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageColorGrayscale($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::process($image, 0, fn(Image $tile) => self::ffi()->ImageColorGrayscale($tile->pointer()));
     }
 
     /**
      * 调整图像对比度(-100到100)
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param float $contrast 对比度值
      * @return void
      */
-    public static function imageColorContrast(Image &$image, float $contrast): void
+    public static function imageColorContrast(Image $image, float $contrast): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageColorContrast($c_image, $contrast);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::process($image, 0, fn(Image $tile) => self::ffi()->ImageColorContrast($tile->pointer(), $contrast));
     }
 
     /**
      * 调整图像亮度(-255到255)
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param int $brightness 亮度值
      * @return void
      */
-    public static function imageColorBrightness(Image &$image, int $brightness): void
+    public static function imageColorBrightness(Image $image, int $brightness): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageColorBrightness($c_image, $brightness);
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::process($image, 0, fn(Image $tile) => self::ffi()->ImageColorBrightness($tile->pointer(), $brightness));
     }
 
     /**
      * 替换图像中的指定颜色
      *
-     * @param Image &$image Image对象引用
+     * @param Image $image Image对象（原地修改）
      * @param Color $color 原始颜色
      * @param Color $replace 新颜色
      * @return void
      */
-    public static function imageColorReplace(Image &$image, Color $color, Color $replace): void
+    public static function imageColorReplace(Image $image, Color $color, Color $replace): void
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        self::ffi()->ImageColorReplace($c_image, $color->struct(), $replace->struct());
-        $image = new Image($c_image[0]);
-        unset($c_image);
+        self::ffi()->ImageColorReplace($image->pointer(), $color->cdata(), $replace->cdata());
     }
 
     /**
      * 从图像加载颜色数组(RGBA 32位)
      *
+     * 返回 raylib 分配的 Color 指针（width*height 个元素），用完后调用 unloadImageColors() 释放。
+     * 逐像素读写原图时用 imagePixels() 视图，不需要转换和复制。
+     *
      * @param Image $image Image对象
-     * @return Color[] 返回颜色数组
+     * @return CData 返回 Color 指针
      */
-    public static function loadImageColors(Image $image): array
+    public static function loadImageColors(Image $image): CData
     {
-        $c_image = self::ffi()->cast('Image *', $image->struct());
-        $colors = self::ffi()->LoadImageColors($c_image);
-        $image = new Image($c_image[0]);
-        unset($c_image);
-        return $colors;
+        return self::ffi()->LoadImageColors($image->struct());
+    }
+
+    /**
+     * 获取图像像素视图，直接读写图像内存
+     *
+     * @param Image $image Image对象
+     * @return PixelView 返回PixelView对象
+     */
+    public static function imagePixels(Image $image): PixelView
+    {
+        return new PixelView($image);
     }
 
     /**
@@ -800,17 +915,12 @@ class Textures extends Base
     /**
      * 卸载LoadImageColors()加载的颜色数据
      *
-     * @param array<int,Color> $colors 颜色数组
+     * @param CData $colors loadImageColors() 返回的 Color 指针
      * @return void
      */
-    public static function unloadImageColors(array $colors): void
+    public static function unloadImageColors(CData $colors): void
     {
-        $c_colors = self::ffi()->new("Color[" . count($colors) . "]");
-        foreach ($colors as $i => $color) {
-            $c_colors[$i] = $color->struct();
-        }
-        self::ffi()->UnloadImageColors(self::ffi()->cast('Color *', $c_colors));
-        unset($c_colors);
+        self::ffi()->UnloadImageColors($colors);
     }
 
     /**
@@ -823,7 +933,7 @@ class Textures extends Base
     {
         $c_colors = self::ffi()->new("Color[" . count($colors) . "]");
         foreach ($colors as $i => $color) {
-            $c_colors[$i] = $color->struct();
+            $c_colors[$i] = $color->cdata();
         }
         self::ffi()->UnloadImagePalette(self::ffi()->cast('Color *', $c_colors));
         unset($c_colors);
@@ -862,55 +972,46 @@ class Textures extends Base
     /**
      * 用指定颜色清除图像背景
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageClearBackground(Image &$dst, Color $color): void
+    public static function imageClearBackground(Image $dst, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageClearBackground($c_dst, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageClearBackground($dst->pointer(), $color->cdata());
     }
 
     /**
      * 在图像上绘制像素
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param int $posX X坐标
      * @param int $posY Y坐标
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawPixel(Image &$dst, int $posX, int $posY, Color $color): void
+    public static function imageDrawPixel(Image $dst, int $posX, int $posY, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawPixel($c_dst, $posX, $posY, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawPixel($dst->pointer(), $posX, $posY, $color->cdata());
     }
 
     /**
      * 向量版像素绘制
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $position Vector2位置
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawPixelV(Image &$dst, Vector2 $position, Color $color): void
+    public static function imageDrawPixelV(Image $dst, Vector2 $position, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawPixelV($c_dst, $position->struct(), $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawPixelV($dst->pointer(), $position->struct(), $color->cdata());
     }
 
     /**
      * 在图像上绘制直线
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param int $startPosX 起始点X坐标
      * @param int $startPosY 起始点Y坐标
      * @param int $endPosX 结束点X坐标
@@ -918,123 +1019,102 @@ class Textures extends Base
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawLine(Image &$dst, int $startPosX, int $startPosY, int $endPosX, int $endPosY, Color $color): void
+    public static function imageDrawLine(Image $dst, int $startPosX, int $startPosY, int $endPosX, int $endPosY, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawLine($c_dst, $startPosX, $startPosY, $endPosX, $endPosY, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawLine($dst->pointer(), $startPosX, $startPosY, $endPosX, $endPosY, $color->cdata());
     }
 
     /**
      * 向量版直线绘制
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $start 起始Vector2位置
      * @param Vector2 $end 结束Vector2位置
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawLineV(Image &$dst, Vector2 $start, Vector2 $end, Color $color): void
+    public static function imageDrawLineV(Image $dst, Vector2 $start, Vector2 $end, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawLineV($c_dst, $start->struct(), $end->struct(), $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawLineV($dst->pointer(), $start->struct(), $end->struct(), $color->cdata());
     }
 
     /**
      * 绘制带粗细的直线
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $start 起始Vector2位置
      * @param Vector2 $end 结束Vector2位置
      * @param int $thick 粗细
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawLineEx(Image &$dst, Vector2 $start, Vector2 $end, int $thick, Color $color): void
+    public static function imageDrawLineEx(Image $dst, Vector2 $start, Vector2 $end, int $thick, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawLineEx($c_dst, $start->struct(), $end->struct(), $thick, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawLineEx($dst->pointer(), $start->struct(), $end->struct(), $thick, $color->cdata());
     }
 
     /**
      * 绘制实心圆
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param int $centerX 圆心X坐标
      * @param int $centerY 圆心Y坐标
      * @param int $radius 半径
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawCircle(Image &$dst, int $centerX, int $centerY, int $radius, Color $color): void
+    public static function imageDrawCircle(Image $dst, int $centerX, int $centerY, int $radius, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawCircle($c_dst, $centerX, $centerY, $radius, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawCircle($dst->pointer(), $centerX, $centerY, $radius, $color->cdata());
     }
 
     /**
      * 向量版实心圆绘制
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $center 圆心Vector2位置
      * @param int $radius 半径
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawCircleV(Image &$dst, Vector2 $center, int $radius, Color $color): void
+    public static function imageDrawCircleV(Image $dst, Vector2 $center, int $radius, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawCircleV($c_dst, $center->struct(), $radius, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawCircleV($dst->pointer(), $center->struct(), $radius, $color->cdata());
     }
 
     /**
      * 绘制圆形轮廓
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param int $centerX 圆心X坐标
      * @param int $centerY 圆心Y坐标
      * @param int $radius 半径
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawCircleLines(Image &$dst, int $centerX, int $centerY, int $radius, Color $color): void
+    public static function imageDrawCircleLines(Image $dst, int $centerX, int $centerY, int $radius, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawCircleLines($c_dst, $centerX, $centerY, $radius, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawCircleLines($dst->pointer(), $centerX, $centerY, $radius, $color->cdata());
     }
 
     /**
      * 向量版圆形轮廓绘制
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $center 圆心Vector2位置
      * @param int $radius 半径
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawCircleLinesV(Image &$dst, Vector2 $center, int $radius, Color $color): void
+    public static function imageDrawCircleLinesV(Image $dst, Vector2 $center, int $radius, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawCircleLinesV($c_dst, $center->struct(), $radius, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawCircleLinesV($dst->pointer(), $center->struct(), $radius, $color->cdata());
     }
 
     /**
      * 绘制实心矩形
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param int $posX X坐标
      * @param int $posY Y坐标
      * @param int $width 宽度
@@ -1042,86 +1122,71 @@ class Textures extends Base
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawRectangle(Image &$dst, int $posX, int $posY, int $width, int $height, Color $color): void
+    public static function imageDrawRectangle(Image $dst, int $posX, int $posY, int $width, int $height, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawRectangle($c_dst, $posX, $posY, $width, $height, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawRectangle($dst->pointer(), $posX, $posY, $width, $height, $color->cdata());
     }
 
     /**
      * 向量版矩形绘制
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $position Vector2位置
      * @param Vector2 $size Vector2大小
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawRectangleV(Image &$dst, Vector2 $position, Vector2 $size, Color $color): void
+    public static function imageDrawRectangleV(Image $dst, Vector2 $position, Vector2 $size, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawRectangleV($c_dst, $position->struct(), $size->struct(), $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawRectangleV($dst->pointer(), $position->struct(), $size->struct(), $color->cdata());
     }
 
     /**
      * 矩形对象版绘制
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Rectangle $rec Rectangle对象
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawRectangleRec(Image &$dst, Rectangle $rec, Color $color): void
+    public static function imageDrawRectangleRec(Image $dst, Rectangle $rec, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawRectangleRec($c_dst, $rec->struct(), $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawRectangleRec($dst->pointer(), $rec->struct(), $color->cdata());
     }
 
     /**
      * 绘制矩形轮廓线
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Rectangle $rec Rectangle对象
      * @param int $thick 粗细
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawRectangleLines(Image &$dst, Rectangle $rec, int $thick, Color $color): void
+    public static function imageDrawRectangleLines(Image $dst, Rectangle $rec, int $thick, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawRectangleLines($c_dst, $rec->struct(), $thick, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawRectangleLines($dst->pointer(), $rec->struct(), $thick, $color->cdata());
     }
 
     /**
      * 绘制实心三角形
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $v1 Vector2顶点1
      * @param Vector2 $v2 Vector2顶点2
      * @param Vector2 $v3 Vector2顶点3
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawTriangle(Image &$dst, Vector2 $v1, Vector2 $v2, Vector2 $v3, Color $color): void
+    public static function imageDrawTriangle(Image $dst, Vector2 $v1, Vector2 $v2, Vector2 $v3, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawTriangle($c_dst, $v1->struct(), $v2->struct(), $v3->struct(), $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawTriangle($dst->pointer(), $v1->struct(), $v2->struct(), $v3->struct(), $color->cdata());
     }
 
     /**
      * 绘制颜色插值三角形
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $v1 Vector2顶点1
      * @param Vector2 $v2 Vector2顶点2
      * @param Vector2 $v3 Vector2顶点3
@@ -1130,94 +1195,79 @@ class Textures extends Base
      * @param Color $c3 Color顶点3颜色
      * @return void
      */
-    public static function imageDrawTriangleEx(Image &$dst, Vector2 $v1, Vector2 $v2, Vector2 $v3, Color $c1, Color $c2, Color $c3): void
+    public static function imageDrawTriangleEx(Image $dst, Vector2 $v1, Vector2 $v2, Vector2 $v3, Color $c1, Color $c2, Color $c3): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawTriangleEx($c_dst, $v1->struct(), $v2->struct(), $v3->struct(), $c1->struct(), $c2->struct(), $c3->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawTriangleEx($dst->pointer(), $v1->struct(), $v2->struct(), $v3->struct(), $c1->cdata(), $c2->cdata(), $c3->cdata());
     }
 
     /**
      * 绘制三角形轮廓
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2 $v1 Vector2顶点1
      * @param Vector2 $v2 Vector2顶点2
      * @param Vector2 $v3 Vector2顶点3
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawTriangleLines(Image &$dst, Vector2 $v1, Vector2 $v2, Vector2 $v3, Color $color): void
+    public static function imageDrawTriangleLines(Image $dst, Vector2 $v1, Vector2 $v2, Vector2 $v3, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawTriangleLines($c_dst, $v1->struct(), $v2->struct(), $v3->struct(), $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawTriangleLines($dst->pointer(), $v1->struct(), $v2->struct(), $v3->struct(), $color->cdata());
     }
 
     /**
      * 绘制三角形扇
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2[] $points 点数组(Vector2类型)
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawTriangleFan(Image &$dst, array $points, Color $color): void
+    public static function imageDrawTriangleFan(Image $dst, array $points, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
         $c_points = self::ffi()->new("Vector2[" . count($points) . "]");
         foreach ($points as $index => $point) {
             $c_points[$index] = $point->struct();
         }
-        self::ffi()->ImageDrawTriangleFan($c_dst, self::ffi()->cast('Vector2 *', $c_points), count($points), $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawTriangleFan($dst->pointer(), self::ffi()->cast('Vector2 *', $c_points), count($points), $color->cdata());
     }
 
     /**
      * 绘制三角形带
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Vector2[] $points 点数组(Vector2类型)
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawTriangleStrip(Image &$dst, array $points, Color $color): void
+    public static function imageDrawTriangleStrip(Image $dst, array $points, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
         $c_points = self::ffi()->new("Vector2[" . count($points) . "]");
         foreach ($points as $index => $point) {
             $c_points[$index] = $point->struct();
         }
-        self::ffi()->ImageDrawTriangleStrip($c_dst, self::ffi()->cast('Vector2 *', $c_points), count($points), $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawTriangleStrip($dst->pointer(), self::ffi()->cast('Vector2 *', $c_points), count($points), $color->cdata());
     }
 
     /**
      * 在目标图像上绘制源图像区域(应用色调)
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Image $src 源Image对象
      * @param Rectangle $srcRec 源矩形区域
      * @param Rectangle $dstRec 目标矩形区域
      * @param Color $tint 色调颜色
      * @return void
      */
-    public static function imageDraw(Image &$dst, Image $src, Rectangle $srcRec, Rectangle $dstRec, Color $tint): void
+    public static function imageDraw(Image $dst, Image $src, Rectangle $srcRec, Rectangle $dstRec, Color $tint): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDraw($c_dst, $src->struct(), $srcRec->struct(), $dstRec->struct(), $tint->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDraw($dst->pointer(), $src->struct(), $srcRec->struct(), $dstRec->struct(), $tint->cdata());
     }
 
     /**
      * 用默认字体绘制文本到图像
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param string $text 文本内容
      * @param int $posX X坐标
      * @param int $posY Y坐标
@@ -1225,18 +1275,15 @@ class Textures extends Base
      * @param Color $color 颜色
      * @return void
      */
-    public static function imageDrawText(Image &$dst, string $text, int $posX, int $posY, int $fontSize, Color $color): void
+    public static function imageDrawText(Image $dst, string $text, int $posX, int $posY, int $fontSize, Color $color): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawText($c_dst, $text, $posX, $posY, $fontSize, $color->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        self::ffi()->ImageDrawText($dst->pointer(), $text, $posX, $posY, $fontSize, $color->cdata());
     }
 
     /**
      * 用自定义字体绘制文本到图像
      *
-     * @param Image &$dst 目标Image对象引用
+     * @param Image $dst 目标Image对象（原地修改）
      * @param Font $font Font对象
      * @param string $text 文本内容
      * @param Vector2 $position 位置(Vector2类型)
@@ -1245,12 +1292,21 @@ class Textures extends Base
      * @param Color $tint 色调颜色
      * @return void
      */
-    public static function imageDrawTextEx(Image &$dst, Font $font, string $text, Vector2 $position, float $fontSize, float $spacing, Color $tint): void    
+    public static function imageDrawTextEx(Image $dst, Font $font, string $text, Vector2 $position, float $fontSize, float $spacing, Color $tint): void    
+    {
+        self::ffi()->ImageDrawTextEx($dst->pointer(), $font->struct(), $text, $position->struct(), $fontSize, $spacing, $tint->cdata());
+    }
+
+    /**
+     * 执行图像绘制命令列表（点、线、矩形、圆），大量图元时代替逐个 imageDraw*() 调用
+     *
+     * @param Image $dst 目标Image对象（原地修改）
+     * @param ImageDrawList $list 命令列表
+     * @return void
+     */
+    public static function imageDrawList(Image $dst, ImageDrawList $list): void
     {
-        $c_dst = self::ffi()->cast('Image *', $dst->struct());
-        self::ffi()->ImageDrawTextEx($c_dst, $font->struct(), $text, $position->struct(), $fontSize, $spacing, $tint->struct());
-        $dst = new Image($c_dst[0]);
-        unset($c_dst);
+        $list->execute($dst);
     }
 
     //### 纹理加载函数
@@ -1421,7 +1477,7 @@ class Textures extends Base
      */
     public static function drawTexture(Texture $texture, int $posX, int $posY, Color $tint): void
     {
-        self::ffi()->DrawTexture($texture->struct(), $posX, $posY, $tint->struct());
+        self::ffi()->DrawTexture($texture->struct(), $posX, $posY, $tint->cdata());
     }
 
     /**
@@ -1434,7 +1490,7 @@ class Textures extends Base
      */
     public static function drawTextureV(Texture $texture, Vector2 $position, Color $tint): void
     {
-        self::ffi()->DrawTextureV($texture->struct(), $position->struct(), $tint->struct());
+        self::ffi()->DrawTextureV($texture->struct(), $position->struct(), $tint->cdata());
     }
 
     /**
@@ -1449,7 +1505,7 @@ class Textures extends Base
      */
     public static function drawTextureEx(Texture $texture, Vector2 $position, float $rotation, float $scale, Color $tint): void
     {
-        self::ffi()->DrawTextureEx($texture->struct(), $position->struct(), $rotation, $scale, $tint->struct());
+        self::ffi()->DrawTextureEx($texture->struct(), $position->struct(), $rotation, $scale, $tint->cdata());
     }
 
     /**
@@ -1463,7 +1519,7 @@ class Textures extends Base
      */
     public static function drawTextureRec(Texture $texture, Rectangle $source, Vector2 $position, Color $tint): void
     {
-        self::ffi()->DrawTextureRec($texture->struct(), $source->struct(), $position->struct(), $tint->struct());
+        self::ffi()->DrawTextureRec($texture->struct(), $source->struct(), $position->struct(), $tint->cdata());
     }
 
     /**
@@ -1479,7 +1535,7 @@ class Textures extends Base
      */
     public static function drawTexturePro(Texture $texture, Rectangle $source, Rectangle $dest, Vector2 $origin, float $rotation, Color $tint): void
     {
-        self::ffi()->DrawTexturePro($texture->struct(), $source->struct(), $dest->struct(), $origin->struct(), $rotation, $tint->struct());
+        self::ffi()->DrawTexturePro($texture->struct(), $source->struct(), $dest->struct(), $origin->struct(), $rotation, $tint->cdata());
     }
 
     /**
@@ -1495,7 +1551,7 @@ class Textures extends Base
      */
     public static function drawTextureNPatch(Texture $texture, NPatchInfo $nPatchInfo, Rectangle $dest, Vector2 $origin, float $rotation, Color $tint): void
     {
-        self::ffi()->DrawTextureNPatch($texture->struct(), $nPatchInfo->struct(), $dest->struct(), $origin->struct(), $rotation, $tint->struct());
+        self::ffi()->DrawTextureNPatch($texture->struct(), $nPatchInfo->struct(), $dest->struct(), $origin->struct(), $rotation, $tint->cdata());
     }
 
     //### 颜色/像素相关函数
@@ -1509,7 +1565,7 @@ class Textures extends Base
      */
     public static function colorIsEqual(Color $col1, Color $col2): bool
     {
-        return self::ffi()->ColorIsEqual($col1->struct(), $col2->struct());
+        return self::ffi()->ColorIsEqual($col1->cdata(), $col2->cdata());
     }
 
     /**
@@ -1521,7 +1577,7 @@ class Textures extends Base
      */
     public static function fade(Color $color, float $alpha): Color
     {
-        $res = self::ffi()->Fade($color->struct(), $alpha);
+        $res = self::ffi()->Fade($color->cdata(), $alpha);
         return new Color($res->r, $res->g, $res->b, $res->a);
     }
 
@@ -1533,7 +1589,7 @@ class Textures extends Base
      */
     public static function colorToInt(Color $color): int
     {
-        return self::ffi()->ColorToInt($color->struct());
+        return self::ffi()->ColorToInt($color->cdata());
     }
 
     /**
@@ -1544,7 +1600,7 @@ class Textures extends Base
      */
     public static function colorNormalize(Color $color): Vector4
     {
-        $res = self::ffi()->ColorNormalize($color->struct());
+        $res = self::ffi()->ColorNormalize($color->cdata());
         return new Vector4($res->x, $res->y, $res->z, $res->w);
     }
 
@@ -1568,7 +1624,7 @@ class Textures extends Base
      */
     public static function colorToHSV(Color $color): Vector3
     {
-        $res = self::ffi()->ColorToHSV($color->struct());
+        $res = self::ffi()->ColorToHSV($color->cdata());
         return new Vector3($res->x, $res->y, $res->z);
     }
 
@@ -1595,7 +1651,7 @@ class Textures extends Base
      */
     public static function colorTint(Color $color, Color $tint): Color
     {
-        $res = self::ffi()->ColorTint($color->struct(), $tint->struct());
+        $res = self::ffi()->ColorTint($color->cdata(), $tint->cdata());
         return new Color($res->r, $res->g, $res->b, $res->a);
     }
 
@@ -1608,7 +1664,7 @@ class Textures extends Base
      */
     public static function colorBrightness(Color $color, float $factor): Color
     {
-        $res = self::ffi()->ColorBrightness($color->struct(), $factor);
+        $res = self::ffi()->ColorBrightness($color->cdata(), $factor);
         return new Color($res->r, $res->g, $res->b, $res->a);
     }
 
@@ -1621,7 +1677,7 @@ class Textures extends Base
      */
     public static function colorContrast(Color $color, float $contrast): Color
     {
-        $res = self::ffi()->ColorContrast($color->struct(), $contrast);
+        $res = self::ffi()->ColorContrast($color->cdata(), $contrast);
         return new Color($res->r, $res->g, $res->b, $res->a);
     }
 
@@ -1634,7 +1690,7 @@ class Textures extends Base
      */
     public static function colorAlpha(Color $color, float $alpha): Color
     {
-        $res = self::ffi()->ColorAlpha($color->struct(), $alpha);
+        $res = self::ffi()->ColorAlpha($color->cdata(), $alpha);
         return new Color($res->r, $res->g, $res->b, $res->a);
     }
 
@@ -1648,7 +1704,7 @@ class Textures extends Base
      */
     public static function colorAlphaBlend(Color $dst, Color $src, Color $tint): Color
     {
-        $res = self::ffi()->ColorAlphaBlend($dst->struct(), $src->struct(), $tint->struct());
+        $res = self::ffi()->ColorAlphaBlend($dst->cdata(), $src->cdata(), $tint->cdata());
         return new Color($res->r, $res->g, $res->b, $res->a);
     }
 
@@ -1662,7 +1718,7 @@ class Textures extends Base
      */
     public static function colorLerp(Color $color1, Color $color2, float $factor): Color
     {
-        $res = self::ffi()->ColorLerp($color1->struct(), $color2->struct(), $factor);
+        $res = self::ffi()->ColorLerp($color1->cdata(), $color2->cdata(), $factor);
         return new Color($res->r, $res->g, $res->b, $res->a);
     }
 
@@ -1701,7 +1757,7 @@ class Textures extends Base
      */
     public static function setPixelColor(string $dstPtr, Color $color, int $format): void
     {
-        self::ffi()->SetPixelColor($dstPtr, $color->struct(), $format); 
+        self::ffi()->SetPixelColor($dstPtr, $color->cdata(), $format); 
     }
 
     /**
@@ -1716,4 +1772,23 @@ class Textures extends Base
     {
         return self::ffi()->GetPixelDataSize($width, $height, $format);
     }
+
+    /**
+     * 执行图像操作，启用并行且图像足够大时按行分块交给子进程
+     *
+     * @param Image $image Image对象（原地修改）
+     * @param int $halo 每块上下额外带上的行数
+     * @param \Closure $kernel 对图像原地执行的操作
+     * @return void
+     */
+    private static function process(Image $image, int $halo, \Closure $kernel): void
+    {
+        if (
+            self::$imageWorkers < 2
+            || $image->width * $image->height < self::PARALLEL_MIN_PIXELS
+            || !(new ImageWorkerPool(self::$imageWorkers))->run($image, $halo, $kernel)
+        ) {
+            $kernel($image);
+        }
+    }
 }
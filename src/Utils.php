@@ -37,6 +37,17 @@ class Utils extends Base
         return new Color($r, $g, $b, $a);
     }
 
+    /**
+     * 调色板颜色（冻结，结构体只创建一次）
+     *
+     * @param string $name 颜色名，如 RAYWHITE、LIGHTGRAY
+     * @return Color
+     */
+    public static function palette(string $name): Color
+    {
+        return Palette::get($name);
+    }
+
     /**
      * 矩形对象2
      *
@@ -0,0 +1,132 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 双二阶滤波器节点（均衡器）
+ *
+ * 系数按 RBJ Audio EQ Cookbook 计算，参数变化后在下一块开始时重新计算。
+ * 参数：frequency 中心/截止频率（Hz），q 品质因数，gain 增益（dB，仅 peaking/lowshelf/highshelf）
+ */
+class AudioBiquad extends AudioNode
+{
+    public const LOWPASS = 'lowpass';
+    public const HIGHPASS = 'highpass';
+    public const BANDPASS = 'bandpass';
+    public const NOTCH = 'notch';
+    public const PEAKING = 'peaking';
+    public const LOWSHELF = 'lowshelf';
+    public const HIGHSHELF = 'highshelf';
+
+    private string $type;
+    private int $sampleRate = 0; // 计算系数时的采样率
+    private array $coefficients = [1.0, 0.0, 0.0, 0.0, 0.0]; // b0 b1 b2 a1 a2（已除以 a0）
+    private array $state = []; // 声道 => [x1, x2, y1, y2]
+
+    /**
+     * 双二阶滤波器节点
+     *
+     * @param string $type 滤波器类型，见类常量
+     * @param float $frequency 频率（Hz）
+     * @param float $q 品质因数
+     * @param float $gain 增益（dB）
+     * @return void
+     * @throws \InvalidArgumentException 如果类型不存在
+     */
+    public function __construct(string $type = self::LOWPASS, float $frequency = 1000.0, float $q = M_SQRT1_2, float $gain = 0.0)
+    {
+        $types = [self::LOWPASS, self::HIGHPASS, self::BANDPASS, self::NOTCH, self::PEAKING, self::LOWSHELF, self::HIGHSHELF];
+        if (!in_array($type, $types, true)) {
+            throw new \InvalidArgumentException("Unknown biquad filter type: " . $type);
+        }
+        $this->type = $type;
+        $this->params = ['frequency' => $frequency, 'q' => $q, 'gain' => $gain];
+    }
+
+    public function reset(): void
+    {
+        $this->state = [];
+    }
+
+    protected function changed(array $previous, int $sampleRate): void
+    {
+        $this->sampleRate = 0;
+    }
+
+    protected function process(array $samples, int $channels, int $sampleRate, array $previous): array
+    {
+        if ($this->sampleRate !== $sampleRate) {
+            $this->coefficients($sampleRate);
+        }
+        [$b0, $b1, $b2, $a1, $a2] = $this->coefficients;
+        $count = count($samples);
+        for ($c = 0; $c < $channels; $c++) {
+            [$x1, $x2, $y1, $y2] = $this->state[$c] ?? [0.0, 0.0, 0.0, 0.0];
+            for ($i = $c; $i < $count; $i += $channels) {
+                $x = $samples[$i];
+                $y = $b0 * $x + $b1 * $x1 + $b2 * $x2 - $a1 * $y1 - $a2 * $y2;
+                $x2 = $x1;
+                $x1 = $x;
+                $y2 = $y1;
+                $y1 = $y;
+                $samples[$i] = $y;
+            }
+            $this->state[$c] = [$x1, $x2, $y1, $y2];
+        }
+        return $samples;
+    }
+
+    /**
+     * 计算滤波器系数
+     *
+     * @param integer $sampleRate 采样率
+     * @return void
+     */
+    private function coefficients(int $sampleRate): void
+    {
+        $frequency = max(1.0, min($this->params['frequency'], $sampleRate * 0.499));
+        $q = max(0.01, $this->params['q']);
+        $w0 = 2 * M_PI * $frequency / $sampleRate;
+        $cos = cos($w0);
+        $alpha = sin($w0) / (2 * $q);
+        $a = 10 ** ($this->params['gain'] / 40);
+
+        switch ($this->type) {
+            case self::LOWPASS:
+                $b = [(1 - $cos) / 2, 1 - $cos, (1 - $cos) / 2];
+                $d = [1 + $alpha, -2 * $cos, 1 - $alpha];
+                break;
+            case self::HIGHPASS:
+                $b = [(1 + $cos) / 2, -(1 + $cos), (1 + $cos) / 2];
+                $d = [1 + $alpha, -2 * $cos, 1 - $alpha];
+                break;
+            case self::BANDPASS:
+                $b = [$alpha, 0.0, -$alpha];
+                $d = [1 + $alpha, -2 * $cos, 1 - $alpha];
+                break;
+            case self::NOTCH:
+                $b = [1.0, -2 * $cos, 1.0];
+                $d = [1 + $alpha, -2 * $cos, 1 - $alpha];
+                break;
+            case self::PEAKING:
+                $b = [1 + $alpha * $a, -2 * $cos, 1 - $alpha * $a];
+                $d = [1 + $alpha / $a, -2 * $cos, 1 - $alpha / $a];
+                break;
+            case self::LOWSHELF:
+                $s = 2 * sqrt($a) * $alpha;
+                $b = [$a * (($a + 1) - ($a - 1) * $cos + $s), 2 * $a * (($a - 1) - ($a + 1) * $cos), $a * (($a + 1) - ($a - 1) * $cos - $s)];
+                $d = [($a + 1) + ($a - 1) * $cos + $s, -2 * (($a - 1) + ($a + 1) * $cos), ($a + 1) + ($a - 1) * $cos - $s];
+                break;
+            default: // HIGHSHELF
+                $s = 2 * sqrt($a) * $alpha;
+                $b = [$a * (($a + 1) + ($a - 1) * $cos + $s), -2 * $a * (($a - 1) + ($a + 1) * $cos), $a * (($a + 1) + ($a - 1) * $cos - $s)];
+                $d = [($a + 1) - ($a - 1) * $cos + $s, 2 * (($a - 1) - ($a + 1) * $cos), ($a + 1) - ($a - 1) * $cos - $s];
+                break;
+        }
+        $this->coefficients = [$b[0] / $d[0], $b[1] / $d[0], $b[2] / $d[0], $d[1] / $d[0], $d[2] / $d[0]];
+        $this->sampleRate = $sampleRate;
+    }
+}
@@ -0,0 +1,130 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 音频处理链
+ *
+ * 按添加顺序串联 AudioNode，在主线程中处理 32 位浮点交错 PCM，结果写入 AudioRingBuffer。
+ * 与 Audio::attachAudioStreamProcessor() 等回调不同，raylib 的音频线程不会进入 PHP，
+ * 线程之间只传递处理好的 PCM。节点参数由 set() 在主线程修改，在下一块处理开始时生效。
+ * 采样率沿链传递：AudioResampler::rates() 之后的节点按转换后的采样率计算系数和时间，
+ * 环形缓冲区的流应使用 outputRate()。
+ *
+ * 用法：
+ * $chain = (new AudioChain(2, 48000))->add(new AudioBiquad(AudioBiquad::LOWPASS, 8000))->add(new AudioGain(0.8));
+ * $chain->write($ring, $pcm);
+ */
+class AudioChain
+{
+    private array $nodes = [];
+    private int $channels;
+    private int $sampleRate;
+
+    /**
+     * 音频处理链
+     *
+     * @param integer $channels 声道数
+     * @param integer $sampleRate 采样率
+     * @return void
+     */
+    public function __construct(int $channels, int $sampleRate)
+    {
+        $this->channels = max(1, $channels);
+        $this->sampleRate = $sampleRate;
+    }
+
+    /**
+     * 追加节点
+     *
+     * @param AudioNode $node 节点
+     * @return static
+     */
+    public function add(AudioNode $node): static
+    {
+        $this->nodes[] = $node;
+        return $this;
+    }
+
+    /**
+     * 链中的节点
+     *
+     * @return array<AudioNode>
+     */
+    public function nodes(): array
+    {
+        return $this->nodes;
+    }
+
+    /**
+     * 处理样本
+     *
+     * @param array<float> $samples 交错排列的样本
+     * @return array<float> 处理后的样本（含重采样节点时长度会变化）
+     */
+    public function processSamples(array $samples): array
+    {
+        $sampleRate = $this->sampleRate;
+        foreach ($this->nodes as $node) {
+            $samples = $node->render($samples, $this->channels, $sampleRate);
+            $sampleRate = $node->outputRate($sampleRate);
+        }
+        return $samples;
+    }
+
+    /**
+     * 链末端输出的采样率（经过采样率转换节点后）
+     *
+     * @return integer
+     */
+    public function outputRate(): int
+    {
+        $sampleRate = $this->sampleRate;
+        foreach ($this->nodes as $node) {
+            $sampleRate = $node->outputRate($sampleRate);
+        }
+        return $sampleRate;
+    }
+
+    /**
+     * 处理 32 位浮点交错 PCM
+     *
+     * @param string $data PCM 数据
+     * @return string 处理后的 PCM 数据
+     */
+    public function process(string $data): string
+    {
+        if ($data === '') {
+            return '';
+        }
+        $samples = $this->processSamples(array_values(unpack('g*', $data)));
+        return $samples ? pack('g*', ...$samples) : '';
+    }
+
+    /**
+     * 处理 PCM 并写入环形缓冲区
+     *
+     * @param AudioRingBuffer $ring 环形缓冲区（32 位流）
+     * @param string $data PCM 数据
+     * @return integer 写入的帧数
+     */
+    public function write(AudioRingBuffer $ring, string $data): int
+    {
+        return $ring->write($this->process($data));
+    }
+
+    /**
+     * 清除所有节点的内部状态
+     *
+     * @return void
+     */
+    public function reset(): void
+    {
+        foreach ($this->nodes as $node) {
+            $node->reset();
+        }
+    }
+}
@@ -0,0 +1,71 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 压缩器节点
+ *
+ * 峰值包络跟随，所有声道共用同一增益（保持声像）。
+ * 参数：threshold 阈值（dB），ratio 压缩比，attack / release 启动和释放时间（毫秒），makeup 补偿增益（dB）
+ */
+class AudioCompressor extends AudioNode
+{
+    private float $envelope = 0.0; // 包络：超过阈值的分贝数
+
+    /**
+     * 压缩器节点
+     *
+     * @param float $threshold 阈值（dB）
+     * @param float $ratio 压缩比
+     * @param float $attack 启动时间（毫秒）
+     * @param float $release 释放时间（毫秒）
+     * @param float $makeup 补偿增益（dB）
+     * @return void
+     */
+    public function __construct(float $threshold = -18.0, float $ratio = 4.0, float $attack = 10.0, float $release = 100.0, float $makeup = 0.0)
+    {
+        $this->params = [
+            'threshold' => $threshold,
+            'ratio' => $ratio,
+            'attack' => $attack,
+            'release' => $release,
+            'makeup' => $makeup,
+        ];
+    }
+
+    public function reset(): void
+    {
+        $this->envelope = 0.0;
+    }
+
+    protected function process(array $samples, int $channels, int $sampleRate, array $previous): array
+    {
+        $threshold = $this->params['threshold'];
+        $slope = 1.0 - 1.0 / max(1.0, $this->params['ratio']);
+        $attack = exp(-1000.0 / (max(0.01, $this->params['attack']) * $sampleRate));
+        $release = exp(-1000.0 / (max(0.01, $this->params['release']) * $sampleRate));
+        $makeup = $this->params['makeup'];
+        $envelope = $this->envelope;
+        $count = count($samples);
+
+        for ($i = 0; $i < $count; $i += $channels) {
+            $peak = 0.0;
+            for ($c = 0; $c < $channels; $c++) {
+                $peak = max($peak, abs($samples[$i + $c]));
+            }
+            // 超过阈值的分贝数
+            $over = $peak > 1e-9 ? max(0.0, 20 * log10($peak) - $threshold) : 0.0;
+            $coefficient = $over > $envelope ? $attack : $release;
+            $envelope = $over + $coefficient * ($envelope - $over);
+            $gain = 10 ** (($makeup - $envelope * $slope) / 20);
+            for ($c = 0; $c < $channels; $c++) {
+                $samples[$i + $c] *= $gain;
+            }
+        }
+        $this->envelope = $envelope;
+        return $samples;
+    }
+}
@@ -0,0 +1,82 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 延迟（回声）节点
+ *
+ * 延迟线在第一次处理时按 maxTime 一次性分配，之后不再增长。
+ * 参数：time 延迟时间（秒，不超过 maxTime），feedback 反馈（0 - 0.99），mix 湿声比例（0 - 1）
+ */
+class AudioDelay extends AudioNode
+{
+    private float $maxTime;
+    private array $line = []; // 交错排列的延迟线
+    private int $length = 0; // 延迟线帧数
+    private int $position = 0; // 写位置（帧）
+
+    /**
+     * 延迟节点
+     *
+     * @param float $time 延迟时间（秒）
+     * @param float $feedback 反馈
+     * @param float $mix 湿声比例
+     * @param float $maxTime 最大延迟时间（秒），决定延迟线长度
+     * @return void
+     */
+    public function __construct(float $time = 0.25, float $feedback = 0.3, float $mix = 0.3, float $maxTime = 2.0)
+    {
+        $this->maxTime = max($time, $maxTime);
+        $this->params = ['time' => $time, 'feedback' => $feedback, 'mix' => $mix];
+    }
+
+    public function reset(): void
+    {
+        $this->line = [];
+        $this->length = 0;
+        $this->position = 0;
+    }
+
+    protected function process(array $samples, int $channels, int $sampleRate, array $previous): array
+    {
+        $length = (int)ceil($this->maxTime * $sampleRate) + 1;
+        if ($this->length !== $length || count($this->line) !== $length * $channels) {
+            $this->line = array_fill(0, $length * $channels, 0.0);
+            $this->length = $length;
+            $this->position = 0;
+        }
+        $delay = max(1, min($length - 1, (int)round($this->params['time'] * $sampleRate)));
+        $feedback = max(0.0, min(0.99, $this->params['feedback']));
+        $wet = max(0.0, min(1.0, $this->params['mix']));
+        $dry = 1.0 - $wet;
+        // 取出延迟线，属性不再引用它，写入时不会复制整个数组
+        $line = $this->line;
+        $this->line = [];
+        $position = $this->position;
+        $count = count($samples);
+
+        for ($i = 0; $i < $count; $i += $channels) {
+            $read = $position - $delay;
+            if ($read < 0) {
+                $read += $length;
+            }
+            $w = $position * $channels;
+            $r = $read * $channels;
+            for ($c = 0; $c < $channels; $c++) {
+                $x = $samples[$i + $c];
+                $delayed = $line[$r + $c];
+                $line[$w + $c] = $x + $delayed * $feedback;
+                $samples[$i + $c] = $x * $dry + $delayed * $wet;
+            }
+            if (++$position === $length) {
+                $position = 0;
+            }
+        }
+        $this->line = $line;
+        $this->position = $position;
+        return $samples;
+    }
+}
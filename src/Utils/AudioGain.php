@@ -0,0 +1,50 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 增益节点
+ *
+ * 参数：gain 线性增益（1.0 不变），变化时在块内线性过渡
+ */
+class AudioGain extends AudioNode
+{
+    /**
+     * 增益节点
+     *
+     * @param float $gain 线性增益
+     * @return void
+     */
+    public function __construct(float $gain = 1.0)
+    {
+        $this->params = ['gain' => $gain];
+    }
+
+    protected function process(array $samples, int $channels, int $sampleRate, array $previous): array
+    {
+        $to = $this->params['gain'];
+        $from = $previous['gain'];
+        $count = count($samples);
+        if ($from == $to) {
+            if ($to != 1.0) {
+                for ($i = 0; $i < $count; $i++) {
+                    $samples[$i] *= $to;
+                }
+            }
+            return $samples;
+        }
+        $frames = max(1, intdiv($count, $channels));
+        $step = ($to - $from) / $frames;
+        $gain = $from;
+        for ($i = 0; $i < $count; $i += $channels) {
+            $gain += $step;
+            for ($c = 0; $c < $channels; $c++) {
+                $samples[$i + $c] *= $gain;
+            }
+        }
+        return $samples;
+    }
+}
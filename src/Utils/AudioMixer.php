@@ -0,0 +1,125 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 混音节点
+ *
+ * 把若干输入通道（bus）混入经过它的主信号。每个输入有自己的 AudioChain（可以为空），
+ * feed() 写入的样本经过该链处理后排队，处理主信号时按块长度取出、乘以增益后相加，不足部分视为静音。
+ * 参数：gain 主信号增益，以及每个输入的 gain0、gain1 …
+ */
+class AudioMixer extends AudioNode
+{
+    private array $chains = []; // 输入 => AudioChain|null
+    private array $queues = []; // 输入 => 待混合的样本
+    private int $channels;
+
+    /**
+     * 混音节点
+     *
+     * @param integer $channels 声道数（与主信号相同）
+     * @param float $gain 主信号增益
+     * @return void
+     */
+    public function __construct(int $channels = 2, float $gain = 1.0)
+    {
+        $this->channels = max(1, $channels);
+        $this->params = ['gain' => $gain];
+    }
+
+    /**
+     * 添加输入
+     *
+     * @param float $gain 输入增益
+     * @param AudioChain|null $chain 输入的处理链，声道数需与主信号相同
+     * @return integer 输入序号，用于 feed() 和参数 gain{序号}
+     */
+    public function addInput(float $gain = 1.0, ?AudioChain $chain = null): int
+    {
+        $bus = count($this->chains);
+        $this->chains[$bus] = $chain;
+        $this->queues[$bus] = [];
+        $this->params['gain' . $bus] = $gain;
+        return $bus;
+    }
+
+    /**
+     * 向输入写入 32 位浮点交错 PCM
+     *
+     * @param integer $bus 输入序号
+     * @param string $data PCM 数据
+     * @return void
+     * @throws \OutOfRangeException 如果输入不存在
+     */
+    public function feed(int $bus, string $data): void
+    {
+        $this->feedSamples($bus, array_values(unpack('g*', $data)));
+    }
+
+    /**
+     * 向输入写入样本
+     *
+     * @param integer $bus 输入序号
+     * @param array<float> $samples 交错排列的样本
+     * @return void
+     * @throws \OutOfRangeException 如果输入不存在
+     */
+    public function feedSamples(int $bus, array $samples): void
+    {
+        if (!array_key_exists($bus, $this->chains)) {
+            throw new \OutOfRangeException("Mixer input " . $bus . " does not exist");
+        }
+        if ($this->chains[$bus] !== null) {
+            $samples = $this->chains[$bus]->processSamples($samples);
+        }
+        $queue = &$this->queues[$bus];
+        foreach ($samples as $sample) {
+            $queue[] = $sample;
+        }
+    }
+
+    /**
+     * 输入中排队的帧数
+     *
+     * @param integer $bus 输入序号
+     * @return integer
+     */
+    public function queuedFrames(int $bus): int
+    {
+        return intdiv(count($this->queues[$bus] ?? []), $this->channels);
+    }
+
+    public function reset(): void
+    {
+        foreach ($this->queues as $bus => $queue) {
+            $this->queues[$bus] = [];
+        }
+        foreach ($this->chains as $chain) {
+            $chain?->reset();
+        }
+    }
+
+    protected function process(array $samples, int $channels, int $sampleRate, array $previous): array
+    {
+        $count = count($samples);
+        $gain = $this->params['gain'];
+        if ($gain != 1.0) {
+            for ($i = 0; $i < $count; $i++) {
+                $samples[$i] *= $gain;
+            }
+        }
+        foreach ($this->queues as $bus => $queue) {
+            $take = min($count, count($queue));
+            $busGain = $this->params['gain' . $bus];
+            for ($i = 0; $i < $take; $i++) {
+                $samples[$i] += $queue[$i] * $busGain;
+            }
+            $this->queues[$bus] = $take === count($queue) ? [] : array_slice($queue, $take);
+        }
+        return $samples;
+    }
+}
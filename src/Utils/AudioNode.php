@@ -0,0 +1,129 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 音频处理节点
+ *
+ * 节点在主线程中按块处理交错排列的 32 位浮点样本（PHP 数组），由 AudioChain 串联，
+ * 处理结果写入 AudioRingBuffer，raylib 的音频线程只读取已经处理好的 PCM，不会回调 PHP。
+ *
+ * 参数通过 set() 放入待处理队列，同一参数只保留最新值，在下一块开始时统一生效，
+ * 处理过程中参数不会变化；增益类参数在块内从旧值线性过渡到新值，避免爆音。
+ */
+abstract class AudioNode
+{
+    // 参数名 => 当前值，子类在构造函数中填写全部参数
+    protected array $params = [];
+
+    // 参数名 => 待生效的值
+    private array $pending = [];
+
+    /**
+     * 设置参数，下一块开始时生效
+     *
+     * @param string $name 参数名
+     * @param float $value 参数值
+     * @return static
+     * @throws \InvalidArgumentException 如果参数不存在
+     */
+    public function set(string $name, float $value): static
+    {
+        if (!array_key_exists($name, $this->params)) {
+            throw new \InvalidArgumentException("Unknown parameter '" . $name . "' for " . static::class);
+        }
+        $this->pending[$name] = $value;
+        return $this;
+    }
+
+    /**
+     * 参数值（包括尚未生效的值）
+     *
+     * @param string $name 参数名
+     * @return float
+     * @throws \InvalidArgumentException 如果参数不存在
+     */
+    public function get(string $name): float
+    {
+        if (!array_key_exists($name, $this->params)) {
+            throw new \InvalidArgumentException("Unknown parameter '" . $name . "' for " . static::class);
+        }
+        return $this->pending[$name] ?? $this->params[$name];
+    }
+
+    /**
+     * 全部参数的当前值
+     *
+     * @return array<string, float>
+     */
+    public function parameters(): array
+    {
+        return $this->pending + $this->params;
+    }
+
+    /**
+     * 应用待生效的参数并处理一块样本
+     *
+     * @param array<float> $samples 交错排列的样本
+     * @param integer $channels 声道数
+     * @param integer $sampleRate 采样率
+     * @return array<float> 处理后的样本
+     */
+    final public function render(array $samples, int $channels, int $sampleRate): array
+    {
+        $previous = $this->params;
+        if ($this->pending) {
+            foreach ($this->pending as $name => $value) {
+                $this->params[$name] = $value;
+            }
+            $this->pending = [];
+            $this->changed($previous, $sampleRate);
+        }
+        return $this->process($samples, $channels, $sampleRate, $previous);
+    }
+
+    /**
+     * 输出样本的采样率，AudioChain 把它作为后续节点的采样率
+     *
+     * @param integer $sampleRate 输入采样率
+     * @return integer
+     */
+    public function outputRate(int $sampleRate): int
+    {
+        return $sampleRate;
+    }
+
+    /**
+     * 清除内部状态（滤波器历史、延迟线等），参数不变
+     *
+     * @return void
+     */
+    public function reset(): void
+    {
+    }
+
+    /**
+     * 参数变化后调用，用于重新计算系数
+     *
+     * @param array<string, float> $previous 变化前的参数
+     * @param integer $sampleRate 采样率
+     * @return void
+     */
+    protected function changed(array $previous, int $sampleRate): void
+    {
+    }
+
+    /**
+     * 处理一块样本
+     *
+     * @param array<float> $samples 交错排列的样本
+     * @param integer $channels 声道数
+     * @param integer $sampleRate 采样率
+     * @param array<string, float> $previous 本块之前的参数，用于块内过渡
+     * @return array<float> 处理后的样本
+     */
+    abstract protected function process(array $samples, int $channels, int $sampleRate, array $previous): array;
+}
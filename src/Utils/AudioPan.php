@@ -0,0 +1,48 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 声像节点（仅立体声）
+ *
+ * 参数：pan -1.0（左）到 1.0（右），0 居中；等功率声像，居中时两声道不变
+ */
+class AudioPan extends AudioNode
+{
+    /**
+     * 声像节点
+     *
+     * @param float $pan 声像位置
+     * @return void
+     */
+    public function __construct(float $pan = 0.0)
+    {
+        $this->params = ['pan' => $pan];
+    }
+
+    protected function process(array $samples, int $channels, int $sampleRate, array $previous): array
+    {
+        if ($channels !== 2) {
+            return $samples;
+        }
+        $to = max(-1.0, min(1.0, $this->params['pan']));
+        $from = max(-1.0, min(1.0, $previous['pan']));
+        if ($from == 0.0 && $to == 0.0) {
+            return $samples;
+        }
+        $count = count($samples);
+        $step = ($to - $from) / max(1, intdiv($count, 2));
+        $pan = $from;
+        for ($i = 0; $i < $count; $i += 2) {
+            $pan += $step;
+            // 居中时两声道增益为 1，偏向一侧时另一侧按余弦衰减
+            $angle = ($pan + 1.0) * M_PI_4;
+            $samples[$i] *= cos($angle) * M_SQRT2;
+            $samples[$i + 1] *= sin($angle) * M_SQRT2;
+        }
+        return $samples;
+    }
+}
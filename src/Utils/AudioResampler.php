@@ -0,0 +1,89 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * 重采样节点（线性插值）
+ *
+ * 输出帧数约为输入帧数 / ratio，块与块之间保留上一帧和小数位置，拼接处连续。
+ * 参数：ratio 读取速度（2.0 为两倍速、音高升高一个八度；输入 44100Hz 输出 48000Hz 时为 44100/48000）
+ *
+ * 用 rates() 创建时是采样率转换，后续节点按输出采样率处理；
+ * 只给 ratio 时是变速效果，输出仍按原采样率播放，后续节点的采样率不变。
+ */
+class AudioResampler extends AudioNode
+{
+    private float $phase = 0.0; // 下一个输出帧相对当前块起点的位置（帧，可以为负，指向上一块最后一帧）
+    private array $last = []; // 上一块的最后一帧
+    private ?int $outputRate; // 采样率转换的输出采样率，null 表示变速效果
+
+    /**
+     * 重采样节点
+     *
+     * @param float $ratio 读取速度
+     * @param integer|null $outputRate 输出采样率（采样率转换），null 表示不改变后续节点的采样率
+     * @return void
+     */
+    public function __construct(float $ratio = 1.0, ?int $outputRate = null)
+    {
+        $this->params = ['ratio' => $ratio];
+        $this->outputRate = $outputRate;
+    }
+
+    /**
+     * 按输入、输出采样率创建
+     *
+     * @param integer $inputRate 输入采样率
+     * @param integer $outputRate 输出采样率
+     * @return self
+     */
+    public static function rates(int $inputRate, int $outputRate): self
+    {
+        return new self($inputRate / $outputRate, $outputRate);
+    }
+
+    public function outputRate(int $sampleRate): int
+    {
+        return $this->outputRate ?? $sampleRate;
+    }
+
+    public function reset(): void
+    {
+        $this->phase = 0.0;
+        $this->last = [];
+    }
+
+    protected function process(array $samples, int $channels, int $sampleRate, array $previous): array
+    {
+        $ratio = max(0.01, $this->params['ratio']);
+        $frames = intdiv(count($samples), $channels);
+        if ($frames === 0) {
+            return [];
+        }
+        if ($ratio == 1.0 && $this->phase == 0.0) {
+            $this->last = array_slice($samples, ($frames - 1) * $channels, $channels);
+            return $samples;
+        }
+        $last = $this->last ?: array_slice($samples, 0, $channels);
+
+        $out = [];
+        $phase = $this->phase;
+        // 插值需要 phase 与 phase + 1 两帧，-1 表示上一块的最后一帧
+        while ($phase < $frames - 1) {
+            $index = (int)floor($phase);
+            $fraction = $phase - $index;
+            for ($c = 0; $c < $channels; $c++) {
+                $a = $index < 0 ? $last[$c] : $samples[$index * $channels + $c];
+                $b = $samples[($index + 1) * $channels + $c];
+                $out[] = $a + ($b - $a) * $fraction;
+            }
+            $phase += $ratio;
+        }
+        $this->phase = $phase - $frames;
+        $this->last = array_slice($samples, ($frames - 1) * $channels, $channels);
+        return $out;
+    }
+}
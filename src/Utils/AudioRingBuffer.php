@@ -0,0 +1,261 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use \FFI\CData;
+
+/**
+ * 音频环形缓冲区
+ *
+ * 绑定一个 AudioStream，创建时一次性分配原生内存，之后写入和提交都不再分配：
+ * write() 把 PCM 数据 memcpy 进环形缓冲区，pump() 在 raylib 的流缓冲区需要填充时
+ * 直接把环形缓冲区中的一个周期交给 UpdateAudioStream()（跨越末尾时经过一个固定的中转缓冲区）。
+ * 数据不足一个周期时用静音补齐并计为欠载（underrun），缓冲区写满时多出的帧被丢弃（overrun）。
+ * 第一次 write() 之前 pump() 不提交任何数据，新建流的两个空子缓冲区不计为欠载。
+ *
+ * pump() 需要在主循环中定期调用（每帧一次即可），周期帧数应与流的子缓冲区大小一致，
+ * 见 Audio::loadAudioRingBuffer()。
+ */
+class AudioRingBuffer extends Base
+{
+    // 头文件模块
+    protected const MODULE = 'audio';
+
+    // raylib 每个音频流有两个子缓冲区
+    private const STREAM_BUFFERS = 2;
+
+    private AudioStream $stream;
+    private int $frameSize; // 每帧字节数
+    private int $periodFrames;
+    private int $capacity; // 字节
+    private CData $ring;
+    private CData $base; // 环形缓冲区首地址
+    private CData $staging; // 跨越末尾或欠载时使用的一个周期
+    private int $read = 0; // 读位置（字节）
+    private int $size = 0; // 已缓冲字节数
+    private int $underruns = 0;
+    private int $underrunFrames = 0;
+    private int $droppedFrames = 0;
+    private int $submittedFrames = 0;
+    private bool $primed = false; // 是否已经写入过数据
+
+    /**
+     * 音频环形缓冲区
+     *
+     * @param AudioStream $stream 音频流
+     * @param integer $periodFrames 每次提交的帧数（流的子缓冲区大小）
+     * @param integer $capacityFrames 缓冲区容量（帧），至少一个周期
+     * @return void
+     * @throws \InvalidArgumentException 如果样本大小或容量无效
+     */
+    public function __construct(AudioStream $stream, int $periodFrames, int $capacityFrames)
+    {
+        if (!in_array($stream->sampleSize, [8, 16, 32], true) || $stream->channels < 1) {
+            throw new \InvalidArgumentException("Unsupported audio stream format: " . $stream->sampleSize . " bit, " . $stream->channels . " channels");
+        }
+        if ($periodFrames < 1 || $capacityFrames < $periodFrames) {
+            throw new \InvalidArgumentException("Ring buffer capacity must hold at least one period of " . $periodFrames . " frames");
+        }
+        $this->stream = $stream;
+        $this->frameSize = intdiv($stream->sampleSize, 8) * $stream->channels;
+        $this->periodFrames = $periodFrames;
+        $this->capacity = $capacityFrames * $this->frameSize;
+
+        $ffi = self::ffi();
+        $this->ring = $ffi->new('unsigned char[' . $this->capacity . ']');
+        $this->base = \FFI::addr($this->ring[0]);
+        $this->staging = $ffi->new('unsigned char[' . ($periodFrames * $this->frameSize) . ']');
+    }
+
+    /**
+     * 写入 PCM 数据（按流的格式交错排列）
+     *
+     * @param string $data PCM 数据，长度应为整帧
+     * @return integer 写入的帧数，缓冲区已满时少于输入帧数
+     */
+    public function write(string $data): int
+    {
+        $frames = intdiv(strlen($data), $this->frameSize);
+        $free = intdiv($this->capacity - $this->size, $this->frameSize);
+        if ($frames > $free) {
+            $this->droppedFrames += $frames - $free;
+            $frames = $free;
+        }
+        $bytes = $frames * $this->frameSize;
+        if ($bytes === 0) {
+            return 0;
+        }
+
+        $write = ($this->read + $this->size) % $this->capacity;
+        $first = min($bytes, $this->capacity - $write);
+        \FFI::memcpy($this->base + $write, $data, $first);
+        if ($first < $bytes) {
+            \FFI::memcpy($this->base, substr($data, $first, $bytes - $first), $bytes - $first);
+        }
+        $this->size += $bytes;
+        $this->primed = true;
+        return $frames;
+    }
+
+    /**
+     * 写入 32 位浮点样本（仅 32 位流）
+     *
+     * @param array<float> $samples 交错排列的样本
+     * @return integer 写入的帧数
+     * @throws \LogicException 如果流不是 32 位
+     */
+    public function writeSamples(array $samples): int
+    {
+        if ($this->stream->sampleSize !== 32) {
+            throw new \LogicException("writeSamples() requires a 32 bit float stream");
+        }
+        return $this->write(pack('g*', ...$samples));
+    }
+
+    /**
+     * 向需要填充的流缓冲区提交数据
+     *
+     * @return integer 提交的周期数（第一次写入之前为 0）
+     */
+    public function pump(): int
+    {
+        if (!$this->primed) {
+            return 0;
+        }
+        $ffi = self::ffi();
+        $stream = $this->stream->struct();
+        $period = $this->periodFrames * $this->frameSize;
+        $periods = 0;
+        while ($periods < self::STREAM_BUFFERS && $ffi->IsAudioStreamProcessed($stream)) {
+            if ($this->size >= $period && $this->read + $period <= $this->capacity) {
+                // 连续的一个周期：直接从环形缓冲区提交
+                $ffi->UpdateAudioStream($stream, $this->base + $this->read, $this->periodFrames);
+            } else {
+                $available = min($this->size, $period);
+                $first = min($available, $this->capacity - $this->read);
+                \FFI::memcpy($this->staging, $this->base + $this->read, $first);
+                if ($first < $available) {
+                    \FFI::memcpy(\FFI::addr($this->staging[$first]), $this->base, $available - $first);
+                }
+                if ($available < $period) {
+                    \FFI::memset(\FFI::addr($this->staging[$available]), $this->silence(), $period - $available);
+                    $this->underruns++;
+                    $this->underrunFrames += intdiv($period - $available, $this->frameSize);
+                }
+                $ffi->UpdateAudioStream($stream, $this->staging, $this->periodFrames);
+            }
+            $consumed = min($this->size, $period);
+            $this->read = ($this->read + $consumed) % $this->capacity;
+            $this->size -= $consumed;
+            $this->submittedFrames += $this->periodFrames;
+            $periods++;
+        }
+        return $periods;
+    }
+
+    /**
+     * 已缓冲、尚未提交的帧数
+     *
+     * @return integer
+     */
+    public function bufferedFrames(): int
+    {
+        return intdiv($this->size, $this->frameSize);
+    }
+
+    /**
+     * 可写入的帧数
+     *
+     * @return integer
+     */
+    public function freeFrames(): int
+    {
+        return intdiv($this->capacity - $this->size, $this->frameSize);
+    }
+
+    /**
+     * 当前延迟（秒）：环形缓冲区中的数据加上流的两个子缓冲区
+     *
+     * @return float
+     */
+    public function latency(): float
+    {
+        $frames = $this->bufferedFrames() + self::STREAM_BUFFERS * $this->periodFrames;
+        return $frames / $this->stream->sampleRate;
+    }
+
+    /**
+     * 统计信息
+     *
+     * - underruns / underrunFrames：数据不足、用静音补齐的次数和帧数
+     * - droppedFrames：缓冲区已满时丢弃的帧数
+     * - submittedFrames：已提交给流的帧数（含静音）
+     * - bufferedFrames / capacityFrames / periodFrames：缓冲状态
+     * - latency / maxLatency：当前延迟和缓冲区写满时的延迟（秒）
+     *
+     * @return array
+     */
+    public function stats(): array
+    {
+        $capacityFrames = intdiv($this->capacity, $this->frameSize);
+        return [
+            'underruns' => $this->underruns,
+            'underrunFrames' => $this->underrunFrames,
+            'droppedFrames' => $this->droppedFrames,
+            'submittedFrames' => $this->submittedFrames,
+            'bufferedFrames' => $this->bufferedFrames(),
+            'capacityFrames' => $capacityFrames,
+            'periodFrames' => $this->periodFrames,
+            'latency' => $this->latency(),
+            'maxLatency' => ($capacityFrames + self::STREAM_BUFFERS * $this->periodFrames) / $this->stream->sampleRate,
+        ];
+    }
+
+    /**
+     * 清零统计计数
+     *
+     * @return void
+     */
+    public function resetStats(): void
+    {
+        $this->underruns = 0;
+        $this->underrunFrames = 0;
+        $this->droppedFrames = 0;
+        $this->submittedFrames = 0;
+    }
+
+    /**
+     * 丢弃已缓冲的数据
+     *
+     * @return void
+     */
+    public function clear(): void
+    {
+        $this->read = 0;
+        $this->size = 0;
+    }
+
+    /**
+     * 绑定的音频流
+     *
+     * @return AudioStream
+     */
+    public function stream(): AudioStream
+    {
+        return $this->stream;
+    }
+
+    /**
+     * 静音字节：8 位样本是无符号的，中点为 128
+     *
+     * @return integer
+     */
+    private function silence(): int
+    {
+        return $this->stream->sampleSize === 8 ? 128 : 0;
+    }
+}
@@ -0,0 +1,142 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use Kingbes\Raylib\Text;
+use \FFI\CData;
+
+/**
+ * 码位集合
+ * 
+ * 加载字体时只光栅化集合中的字符，可由区间、文本语料或 Unicode 区块组成。
+ */
+class CodepointSet extends Base implements \Countable
+{
+    // 头文件模块
+    protected const MODULE = 'text';
+
+    // 常用 Unicode 区块
+    public const BLOCKS = [
+        'ASCII' => [0x20, 0x7E], // 基本拉丁字母（可打印字符）
+        'LATIN1' => [0xA0, 0xFF], // 拉丁字母补充
+        'GREEK' => [0x370, 0x3FF], // 希腊字母
+        'CYRILLIC' => [0x400, 0x4FF], // 西里尔字母
+        'GENERAL_PUNCTUATION' => [0x2000, 0x206F], // 常用标点
+        'CJK_SYMBOLS' => [0x3000, 0x303F], // 中日韩符号和标点
+        'HIRAGANA' => [0x3040, 0x309F], // 平假名
+        'KATAKANA' => [0x30A0, 0x30FF], // 片假名
+        'CJK' => [0x4E00, 0x9FFF], // 中日韩统一表意文字
+        'HANGUL' => [0xAC00, 0xD7AF], // 韩文音节
+        'FULLWIDTH' => [0xFF00, 0xFFEF], // 半角及全角字符
+    ];
+
+    // 码位 => true
+    private array $codepoints = [];
+
+    /**
+     * 从文本语料创建
+     *
+     * @param string $text UTF-8文本
+     * @return static
+     */
+    public static function fromText(string $text): static
+    {
+        return (new static())->addText($text);
+    }
+
+    /**
+     * 添加码位区间
+     *
+     * @param integer $first 第一个码位
+     * @param integer $last 最后一个码位（包含）
+     * @return static
+     */
+    public function addRange(int $first, int $last): static
+    {
+        for ($codepoint = $first; $codepoint <= $last; $codepoint++) {
+            $this->codepoints[$codepoint] = true;
+        }
+        return $this;
+    }
+
+    /**
+     * 添加文本中出现的全部码位
+     *
+     * @param string $text UTF-8文本
+     * @return static
+     */
+    public function addText(string $text): static
+    {
+        foreach (Text::codepoints($text) as $codepoint) {
+            $this->codepoints[$codepoint] = true;
+        }
+        return $this;
+    }
+
+    /**
+     * 添加 Unicode 区块
+     *
+     * @param string $name 区块名，见 CodepointSet::BLOCKS
+     * @return static
+     * @throws \InvalidArgumentException 如果区块不存在
+     */
+    public function addBlock(string $name): static
+    {
+        if (!isset(self::BLOCKS[$name])) {
+            throw new \InvalidArgumentException("Unknown unicode block: " . $name);
+        }
+        return $this->addRange(...self::BLOCKS[$name]);
+    }
+
+    /**
+     * 是否包含码位
+     *
+     * @param integer $codepoint 码位
+     * @return bool
+     */
+    public function has(int $codepoint): bool
+    {
+        return isset($this->codepoints[$codepoint]);
+    }
+
+    /**
+     * 码位数量
+     *
+     * @return integer
+     */
+    public function count(): int
+    {
+        return count($this->codepoints);
+    }
+
+    /**
+     * 升序码位数组
+     *
+     * @return array<int>
+     */
+    public function toArray(): array
+    {
+        $codepoints = array_keys($this->codepoints);
+        sort($codepoints);
+        return $codepoints;
+    }
+
+    /**
+     * 码位数组结构体
+     *
+     * @return CData int[count]
+     */
+    public function struct(): CData
+    {
+        $codepoints = $this->toArray();
+        $c_codepoints = self::ffi()->new('int[' . max(1, count($codepoints)) . ']');
+        foreach ($codepoints as $i => $codepoint) {
+            $c_codepoints[$i] = $codepoint;
+        }
+        return $c_codepoints;
+    }
+}
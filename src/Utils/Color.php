@@ -10,13 +10,19 @@ use \FFI\CData;
 
 /**
  * 颜色对象
+ * 
+ * @property int $r 红 0-255
+ * @property int $g 绿 0-255
+ * @property int $b 蓝 0-255
+ * @property int $a 透明度 0-255
  */
 class Color extends Base
 {
-    public int $r;
-    public int $g;
-    public int $b;
-    public int $a;
+    // 常驻结构体，属性读写直接作用于它
+    private CData $data;
+
+    // 冻结后属性只读（调色板颜色）
+    private bool $frozen = false;
 
     /**
      * 颜色对象
@@ -29,24 +35,108 @@ class Color extends Base
      */
     public function __construct(int $r, int $g, int $b, int $a = 255)
     {
-        $this->r = $r;
-        $this->g = $g;
-        $this->b = $b;
-        $this->a = $a;
+        $this->data = self::ffi()->new('struct Color');
+        $this->data->r = $r;
+        $this->data->g = $g;
+        $this->data->b = $b;
+        $this->data->a = $a;
     }
 
     /**
      * 颜色对象结构体
      *
+     * 返回对象自身持有的结构体，不会重新分配；
+     * 冻结的颜色返回结构体副本，修改副本不会影响共享的颜色
+     *
      * @return CData
      */
     public function struct(): CData
     {
-        $color = self::ffi()->new('struct Color');
-        $color->r = $this->r;
-        $color->g = $this->g;
-        $color->b = $this->b;
-        $color->a = $this->a;
-        return $color;
+        return $this->frozen ? clone $this->data : $this->data;
+    }
+
+    /**
+     * 颜色结构体（绘制函数内部使用，冻结的颜色也不复制）
+     *
+     * 结构体按值传给 raylib 时 FFI 会复制，所以内部绘制路径直接传递共享的结构体，
+     * 冻结的调色板颜色每次绘制不再分配。调用方不要修改返回的结构体，需要修改时用 struct()。
+     *
+     * @internal
+     * @return CData
+     */
+    public function cdata(): CData
+    {
+        return $this->data;
+    }
+
+    /**
+     * 读取结构体字段
+     *
+     * @param string $name 字段名
+     * @return integer
+     */
+    public function __get(string $name): int
+    {
+        return $this->data->$name;
+    }
+
+    /**
+     * 写入结构体字段
+     *
+     * @param string $name 字段名
+     * @param integer $value 字段值
+     * @return void
+     */
+    public function __set(string $name, int $value): void
+    {
+        if ($this->frozen) {
+            throw new \LogicException("Cannot modify a frozen color, clone it first");
+        }
+        $this->data->$name = $value;
+    }
+
+    /**
+     * 字段是否存在
+     *
+     * @param string $name 字段名
+     * @return bool
+     */
+    public function __isset(string $name): bool
+    {
+        return in_array($name, ['r', 'g', 'b', 'a'], true);
+    }
+
+    /**
+     * 冻结颜色，之后属性只读，struct() 返回副本
+     *
+     * @return static
+     */
+    public function freeze(): static
+    {
+        $this->frozen = true;
+        return $this;
+    }
+
+    /**
+     * 是否已冻结
+     *
+     * @return bool
+     */
+    public function isFrozen(): bool
+    {
+        return $this->frozen;
+    }
+
+    /**
+     * 复制对象时复制结构体，避免共用同一块内存
+     *
+     * 复制出的颜色不再冻结，可以修改
+     *
+     * @return void
+     */
+    public function __clone(): void
+    {
+        $this->data = clone $this->data;
+        $this->frozen = false;
     }
 }
@@ -0,0 +1,315 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use Kingbes\Raylib\Text;
+use \FFI\CData;
+
+/**
+ * 动态字体
+ *
+ * 字形在第一次绘制时才光栅化，按页存放在多张图集纹理中。
+ * 每页满 glyphsPerPage 个字形后新开一页，图集总显存超过预算时卸载最久未使用的页。
+ * 适合无法预知字符集的 CJK 界面，启动快且内存有上限。
+ *
+ * @property int $fontSize 光栅化字号
+ */
+class DynamicFont extends Base
+{
+    // 头文件模块
+    protected const MODULE = 'text';
+
+    public readonly int $fontSize; // 光栅化字号
+    public int $lineSpacing = 2; // 换行行间距，与 raylib 默认值一致
+
+    private CData $fileData; // 字体文件数据
+    private int $dataSize;
+    private string $fileType;
+    private int $glyphsPerPage;
+    private int $maxBytes;
+
+    // 页：['font' => Font, 'codepoints' => int[], 'lastUsed' => int]
+    private array $pages = [];
+    // 码位 => [页索引, 页字体中的字形索引（Font::glyphIndex()）]
+    private array $glyphs = [];
+    private int $nextPage = 0;
+    private int $tick = 0;
+
+    /**
+     * 动态字体
+     *
+     * @param string $fileName 字体文件（.ttf/.otf）
+     * @param integer $fontSize 光栅化字号
+     * @param integer $glyphsPerPage 每页图集的字形数量
+     * @param integer $maxBytes 图集显存预算（字节）
+     * @return void
+     * @throws \RuntimeException 如果无法读取字体文件
+     */
+    public function __construct(string $fileName, int $fontSize, int $glyphsPerPage = 256, int $maxBytes = 16 * 1024 * 1024)
+    {
+        $data = @file_get_contents($fileName);
+        if ($data === false || $data === '') {
+            throw new \RuntimeException("Unable to read font file: " . $fileName);
+        }
+        $this->dataSize = strlen($data);
+        $this->fileData = self::ffi()->new('unsigned char[' . $this->dataSize . ']');
+        \FFI::memcpy($this->fileData, $data, $this->dataSize);
+        $this->fileType = '.' . strtolower(pathinfo($fileName, PATHINFO_EXTENSION));
+        $this->fontSize = $fontSize;
+        $this->glyphsPerPage = max(1, $glyphsPerPage);
+        $this->maxBytes = $maxBytes;
+    }
+
+    /**
+     * 绘制文本，缺失的字形先光栅化
+     *
+     * @param string $text 文本内容
+     * @param Vector2 $position 位置
+     * @param float $fontSize 字体大小
+     * @param float $spacing 字间距
+     * @param Color $tint 颜色
+     * @return void
+     */
+    public function draw(string $text, Vector2 $position, float $fontSize, float $spacing, Color $tint): void
+    {
+        $codepoints = $this->prepare($text);
+        $ffi = self::ffi();
+        $scale = $fontSize / $this->fontSize;
+        $pos = $ffi->new('Vector2');
+        $offsetX = 0.0;
+        $offsetY = 0.0;
+        foreach ($codepoints as $codepoint) {
+            if ($codepoint === 0x0A) {
+                $offsetX = 0.0;
+                $offsetY += $fontSize + $this->lineSpacing;
+                continue;
+            }
+            [$page, $index] = $this->glyphs[$codepoint];
+            $font = $this->pages[$page]['font']->struct();
+            if ($codepoint !== 0x20 && $codepoint !== 0x09) {
+                $pos->x = $position->x + $offsetX;
+                $pos->y = $position->y + $offsetY;
+                $ffi->DrawTextCodepoint($font, $codepoint, $pos, $fontSize, $tint->cdata());
+            }
+            $offsetX += $this->advance($font, $index) * $scale + $spacing;
+        }
+    }
+
+    /**
+     * 测量文本尺寸，缺失的字形先光栅化
+     *
+     * @param string $text 文本内容
+     * @param float $fontSize 字体大小
+     * @param float $spacing 字间距
+     * @return Vector2
+     */
+    public function measure(string $text, float $fontSize, float $spacing): Vector2
+    {
+        $scale = $fontSize / $this->fontSize;
+        $width = 0.0;
+        $lineWidth = 0.0;
+        $lineGlyphs = 0;
+        $lines = 1;
+        foreach ($this->prepare($text) as $codepoint) {
+            if ($codepoint === 0x0A) {
+                $width = max($width, $lineWidth + max(0, $lineGlyphs - 1) * $spacing);
+                $lineWidth = 0.0;
+                $lineGlyphs = 0;
+                $lines++;
+                continue;
+            }
+            [$page, $index] = $this->glyphs[$codepoint];
+            $lineWidth += $this->advance($this->pages[$page]['font']->struct(), $index) * $scale;
+            $lineGlyphs++;
+        }
+        $width = max($width, $lineWidth + max(0, $lineGlyphs - 1) * $spacing);
+        return new Vector2($width, $fontSize * $lines + $this->lineSpacing * ($lines - 1));
+    }
+
+    /**
+     * 已光栅化的字形数量
+     *
+     * @return integer
+     */
+    public function glyphCount(): int
+    {
+        return count($this->glyphs);
+    }
+
+    /**
+     * 当前图集页数
+     *
+     * @return integer
+     */
+    public function pageCount(): int
+    {
+        return count($this->pages);
+    }
+
+    /**
+     * 图集占用的显存字节数
+     *
+     * @return integer
+     */
+    public function atlasBytes(): int
+    {
+        $bytes = 0;
+        foreach ($this->pages as $page) {
+            $bytes += $page['font']->atlasBytes();
+        }
+        return $bytes;
+    }
+
+    /**
+     * 卸载全部图集
+     *
+     * @return void
+     */
+    public function unload(): void
+    {
+        foreach ($this->pages as $page) {
+            self::ffi()->UnloadFont($page['font']->struct());
+        }
+        $this->pages = [];
+        $this->glyphs = [];
+    }
+
+    /**
+     * 解码文本，光栅化缺失的字形并刷新用到的页
+     *
+     * @param string $text 文本内容
+     * @return array<int> 码位
+     */
+    private function prepare(string $text): array
+    {
+        $codepoints = Text::codepoints($text);
+        $this->tick++;
+
+        $missing = [];
+        foreach ($codepoints as $codepoint) {
+            if (isset($this->glyphs[$codepoint])) {
+                $this->pages[$this->glyphs[$codepoint][0]]['lastUsed'] = $this->tick;
+            } elseif ($codepoint !== 0x0A) {
+                $missing[$codepoint] = true;
+            }
+        }
+        if ($missing) {
+            $this->rasterize(array_keys($missing));
+        }
+        return $codepoints;
+    }
+
+    /**
+     * 把缺失的码位加入未满的页并重新生成这些页的图集
+     *
+     * @param array<int> $codepoints 缺失的码位
+     * @return void
+     */
+    private function rasterize(array $codepoints): void
+    {
+        $dirty = [];
+        foreach ($codepoints as $codepoint) {
+            $page = $this->openPage();
+            $this->pages[$page]['codepoints'][] = $codepoint;
+            $this->glyphs[$codepoint] = [$page, 0]; // 字形索引在 build() 后从新字体中取
+            $this->pages[$page]['lastUsed'] = $this->tick;
+            $dirty[$page] = true;
+        }
+        foreach (array_keys($dirty) as $page) {
+            $this->build($page);
+        }
+        $this->evict();
+    }
+
+    /**
+     * 返回未满的页，没有则新建
+     *
+     * @return integer 页索引
+     */
+    private function openPage(): int
+    {
+        foreach ($this->pages as $index => $page) {
+            if (count($page['codepoints']) < $this->glyphsPerPage) {
+                return $index;
+            }
+        }
+        $index = $this->nextPage++;
+        $this->pages[$index] = ['font' => null, 'codepoints' => [], 'lastUsed' => $this->tick];
+        return $index;
+    }
+
+    /**
+     * 用页内全部码位重新生成图集（LoadFontData + GenImageFontAtlas）
+     *
+     * @param integer $page 页索引
+     * @return void
+     */
+    private function build(int $page): void
+    {
+        $codepoints = $this->pages[$page]['codepoints'];
+        $c_codepoints = self::ffi()->new('int[' . count($codepoints) . ']');
+        foreach ($codepoints as $i => $codepoint) {
+            $c_codepoints[$i] = $codepoint;
+        }
+        if ($this->pages[$page]['font'] !== null) {
+            self::ffi()->UnloadFont($this->pages[$page]['font']->struct());
+        }
+        $this->pages[$page]['font'] = new Font(self::ffi()->LoadFontFromMemory(
+            $this->fileType,
+            $this->fileData,
+            $this->dataSize,
+            $this->fontSize,
+            $c_codepoints,
+            count($codepoints)
+        ));
+        // 字形索引以重建后的字体为准，不假设与页内码位顺序相同
+        $font = $this->pages[$page]['font'];
+        foreach ($codepoints as $codepoint) {
+            $this->glyphs[$codepoint] = [$page, $font->glyphIndex($codepoint)];
+        }
+    }
+
+    /**
+     * 超出显存预算时卸载最久未使用的页（本次用到的页不卸载）
+     *
+     * @return void
+     */
+    private function evict(): void
+    {
+        $bytes = $this->atlasBytes();
+        while ($bytes > $this->maxBytes && count($this->pages) > 1) {
+            $oldest = null;
+            foreach ($this->pages as $index => $page) {
+                if ($page['lastUsed'] < $this->tick && ($oldest === null || $page['lastUsed'] < $this->pages[$oldest]['lastUsed'])) {
+                    $oldest = $index;
+                }
+            }
+            if ($oldest === null) {
+                return;
+            }
+            $bytes -= $this->pages[$oldest]['font']->atlasBytes();
+            self::ffi()->UnloadFont($this->pages[$oldest]['font']->struct());
+            foreach ($this->pages[$oldest]['codepoints'] as $codepoint) {
+                unset($this->glyphs[$codepoint]);
+            }
+            unset($this->pages[$oldest]);
+        }
+    }
+
+    /**
+     * 字形的水平前进量（未缩放）
+     *
+     * @param CData $font 字体结构体
+     * @param integer $index 字形索引
+     * @return float
+     */
+    private function advance(CData $font, int $index): float
+    {
+        $advanceX = $font->glyphs[$index]->advanceX;
+        return $advanceX === 0 ? $font->recs[$index]->width : (float)$advanceX;
+    }
+}
@@ -36,4 +36,18 @@ class FilePathList extends Base
     {
         return $this->data;
     }
+
+    /**
+     * 全部路径转为字符串数组
+     *
+     * @return array<string>
+     */
+    public function toArray(): array
+    {
+        $paths = [];
+        for ($i = 0; $i < $this->count; $i++) {
+            $paths[] = \FFI::string($this->data->paths[$i]);
+        }
+        return $paths;
+    }
 }
@@ -6,6 +6,7 @@ declare(strict_types=1);
 namespace Kingbes\Raylib\Utils;
 
 use Kingbes\Raylib\Base;
+use Kingbes\Raylib\PixelFormat;
 use \FFI\CData;
 
 /**
@@ -21,6 +22,10 @@ class Font extends Base
     public int $glyphCount; // 字体字符数量
     public int $glyphPadding; // 字体字符间距
     private CData $data;
+    private ?array $indices = null; // 码位 => 字形索引，第一次查找时建立
+    private int $fallback = 0; // '?' 的字形索引
+    private ?CData $indexedGlyphs = null; // 建表时的 glyphs 指针
+    private int $indexedCount = 0; // 建表时的字形数量
 
     public function __construct(CData $cdata)
     {
@@ -42,4 +47,64 @@ class Font extends Base
         $this->data->glyphPadding = $this->glyphPadding;
         return $this->data;
     }
+
+    /**
+     * 获取码位对应的字形索引（未找到返回'?'索引）
+     *
+     * 与 raylib GetGlyphIndex() 结果一致，但用哈希表代替逐个字形的线性查找，
+     * 查找表在第一次调用时建立，大字库（CJK 上万字形）下每个字符的开销不随字形数增长。
+     * glyphs 指针或 glyphCount 变化时自动重建；原地修改字形码位后需调用 invalidateGlyphIndex()。
+     *
+     * @param integer $codepoint 码位
+     * @return integer 字形索引
+     */
+    public function glyphIndex(int $codepoint): int
+    {
+        if (
+            $this->indices === null
+            || $this->indexedCount !== $this->glyphCount
+            || $this->indexedGlyphs != $this->data->glyphs
+        ) {
+            $this->buildIndices();
+        }
+        return $this->indices[$codepoint] ?? $this->fallback;
+    }
+
+    /**
+     * 丢弃字形索引查找表，下次 glyphIndex() 时重新建立
+     *
+     * @return void
+     */
+    public function invalidateGlyphIndex(): void
+    {
+        $this->indices = null;
+    }
+
+    /**
+     * 字体图集纹理占用的显存字节数
+     *
+     * @return integer
+     */
+    public function atlasBytes(): int
+    {
+        $texture = $this->data->texture;
+        return intdiv($texture->width * $texture->height * (PixelFormat::tryFrom($texture->format)?->bitsPerPixel() ?? 32), 8);
+    }
+
+    /**
+     * 建立码位 => 字形索引的查找表，重复码位取第一个（与 raylib 一致）
+     *
+     * @return void
+     */
+    private function buildIndices(): void
+    {
+        $this->indices = [];
+        $glyphs = $this->struct()->glyphs;
+        $this->indexedGlyphs = $glyphs;
+        $this->indexedCount = $this->glyphCount;
+        for ($i = 0, $n = $this->glyphCount; $i < $n; $i++) {
+            $this->indices[$glyphs[$i]->value] ??= $i;
+        }
+        $this->fallback = $this->indices[63] ?? 0;
+    }
 }
@@ -10,19 +10,26 @@ use \FFI\CData;
 
 /**
  * 图像对象
- * 
- * @property int $width 图像宽度
- * @property int $height 图像高度
- * @property int $mipmaps 图像MIP地图数量
- * @property int $format 图像像素格式
+ *
+ * 持有一个 raylib Image 结构体，Textures::image*() 等原地操作通过 pointer() 直接修改它，
+ * 不会重新创建对象。宽高、格式等字段在读取时从结构体取值，始终是最新的。
+ *
+ * @property-read int $width 图像宽度
+ * @property-read int $height 图像高度
+ * @property-read int $mipmaps 图像MIP地图数量
+ * @property-read int $format 图像像素格式
  */
 class Image extends Base
 {
-    public readonly int $width;
-    public readonly int $height;
-    public readonly int $mipmaps;
-    public readonly int $format;
-    private CData $data;
+    // raylib 能分配和处理的最大像素数据字节数：MemAlloc() 的参数是 unsigned int，
+    // GetPixelDataSize() 等内部计算用 int，超过 INT_MAX 会被截断
+    public const MAX_DATA_SIZE = 0x7FFFFFFF;
+
+    // 可读取的结构体字段
+    private const FIELDS = ['width', 'height', 'mipmaps', 'format'];
+
+    private CData $data; // struct Image
+    private CData $pointer; // Image *，指向 $data
 
     /**
      * 图像对象
@@ -32,11 +39,34 @@ class Image extends Base
      */
     public function __construct(CData $cdata)
     {
-        $this->width = $cdata->width;
-        $this->height = $cdata->height;
-        $this->mipmaps = $cdata->mipmaps;
-        $this->format = $cdata->format;
         $this->data = $cdata;
+        $this->pointer = \FFI::addr($cdata);
+    }
+
+    /**
+     * 读取结构体字段
+     *
+     * @param string $name 字段名
+     * @return integer
+     * @throws \LogicException 如果字段不存在
+     */
+    public function __get(string $name): int
+    {
+        if (!in_array($name, self::FIELDS, true)) {
+            throw new \LogicException("Undefined property: " . self::class . "::$" . $name);
+        }
+        return $this->data->$name;
+    }
+
+    /**
+     * 字段是否存在
+     *
+     * @param string $name 字段名
+     * @return boolean
+     */
+    public function __isset(string $name): bool
+    {
+        return in_array($name, self::FIELDS, true);
     }
 
     /**
@@ -48,4 +78,25 @@ class Image extends Base
     {
         return $this->data;
     }
+
+    /**
+     * 指向图像结构体的指针，传给原地修改图像的 raylib 函数（Image *）
+     *
+     * @return CData
+     */
+    public function pointer(): CData
+    {
+        return $this->pointer;
+    }
+
+    /**
+     * 像素视图，直接读写图像内存
+     *
+     * @return PixelView
+     * @throws \InvalidArgumentException 如果是压缩格式或没有像素数据
+     */
+    public function pixels(): PixelView
+    {
+        return new PixelView($this);
+    }
 }
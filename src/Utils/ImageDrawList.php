@@ -0,0 +1,246 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use Kingbes\Raylib\PixelFormat;
+
+/**
+ * 图像绘制命令列表
+ *
+ * 把大量 CPU 图像绘制图元（点、线、矩形、圆）记录为 PHP 数组，再一次性对图像执行。
+ * 执行时每种颜色只构造一次 Color 结构体，图像指针只取一次，每条命令只剩一次 raylib 调用；
+ * R8G8B8A8 图像上同一行连续的像素命令合并成一次 memcpy，不再逐个调用 ImageDrawPixel()。
+ * 列表可以对多张图像重复执行，clear() 后复用。
+ */
+class ImageDrawList extends Base implements \Countable
+{
+    // 头文件模块
+    protected const MODULE = 'textures';
+
+    // 命令类型
+    public const PIXEL = 0;
+    public const LINE = 1;
+    public const RECTANGLE = 2;
+    public const RECTANGLE_LINES = 3;
+    public const CIRCLE = 4;
+    public const CIRCLE_LINES = 5;
+
+    private array $commands = []; // [op, a, b, c, d, e, 颜色键]
+    private array $colors = []; // 颜色键 => [r, g, b, a]
+
+    /**
+     * 绘制像素
+     *
+     * @param integer $x 横坐标
+     * @param integer $y 纵坐标
+     * @param Color $color 颜色
+     * @return static
+     */
+    public function pixel(int $x, int $y, Color $color): static
+    {
+        $this->commands[] = [self::PIXEL, $x, $y, 0, 0, 0, $this->color($color)];
+        return $this;
+    }
+
+    /**
+     * 绘制线段
+     *
+     * @param integer $startX 起点横坐标
+     * @param integer $startY 起点纵坐标
+     * @param integer $endX 终点横坐标
+     * @param integer $endY 终点纵坐标
+     * @param Color $color 颜色
+     * @return static
+     */
+    public function line(int $startX, int $startY, int $endX, int $endY, Color $color): static
+    {
+        $this->commands[] = [self::LINE, $startX, $startY, $endX, $endY, 0, $this->color($color)];
+        return $this;
+    }
+
+    /**
+     * 绘制实心矩形
+     *
+     * @param integer $x 左上角横坐标
+     * @param integer $y 左上角纵坐标
+     * @param integer $width 宽度
+     * @param integer $height 高度
+     * @param Color $color 颜色
+     * @return static
+     */
+    public function rectangle(int $x, int $y, int $width, int $height, Color $color): static
+    {
+        $this->commands[] = [self::RECTANGLE, $x, $y, $width, $height, 0, $this->color($color)];
+        return $this;
+    }
+
+    /**
+     * 绘制矩形边框
+     *
+     * @param integer $x 左上角横坐标
+     * @param integer $y 左上角纵坐标
+     * @param integer $width 宽度
+     * @param integer $height 高度
+     * @param integer $thick 线宽
+     * @param Color $color 颜色
+     * @return static
+     */
+    public function rectangleLines(int $x, int $y, int $width, int $height, int $thick, Color $color): static
+    {
+        $this->commands[] = [self::RECTANGLE_LINES, $x, $y, $width, $height, $thick, $this->color($color)];
+        return $this;
+    }
+
+    /**
+     * 绘制实心圆
+     *
+     * @param integer $centerX 圆心横坐标
+     * @param integer $centerY 圆心纵坐标
+     * @param integer $radius 半径
+     * @param Color $color 颜色
+     * @return static
+     */
+    public function circle(int $centerX, int $centerY, int $radius, Color $color): static
+    {
+        $this->commands[] = [self::CIRCLE, $centerX, $centerY, $radius, 0, 0, $this->color($color)];
+        return $this;
+    }
+
+    /**
+     * 绘制圆形边框
+     *
+     * @param integer $centerX 圆心横坐标
+     * @param integer $centerY 圆心纵坐标
+     * @param integer $radius 半径
+     * @param Color $color 颜色
+     * @return static
+     */
+    public function circleLines(int $centerX, int $centerY, int $radius, Color $color): static
+    {
+        $this->commands[] = [self::CIRCLE_LINES, $centerX, $centerY, $radius, 0, 0, $this->color($color)];
+        return $this;
+    }
+
+    /**
+     * 按记录顺序把全部命令绘制到图像上
+     *
+     * @param Image $dst 目标图像（原地修改）
+     * @return void
+     */
+    public function execute(Image $dst): void
+    {
+        $ffi = self::ffi();
+        $image = $dst->pointer();
+        $structs = [];
+        foreach ($this->colors as $key => [$r, $g, $b, $a]) {
+            $color = $ffi->new('Color');
+            $color->r = $r;
+            $color->g = $g;
+            $color->b = $b;
+            $color->a = $a;
+            $structs[$key] = $color;
+        }
+
+        // R8G8B8A8：像素命令直接写内存
+        $width = $image->width;
+        $height = $image->height;
+        $direct = $image->format === PixelFormat::R8G8B8A8->value && !\FFI::isNull($image->data);
+        $bytes = $direct ? $ffi->cast('unsigned char *', $image->data) : null;
+        $packed = [];
+        $run = ''; // 正在合并的像素
+        $runStart = 0; // 起始字节偏移
+        $runEnd = -1; // 下一个可以接上的字节偏移
+
+        $rec = $ffi->new('Rectangle');
+        foreach ($this->commands as [$op, $a, $b, $c, $d, $e, $key]) {
+            if ($op === self::PIXEL && $direct) {
+                if ($a < 0 || $a >= $width || $b < 0 || $b >= $height) {
+                    continue;
+                }
+                $offset = ($b * $width + $a) * 4;
+                if ($offset !== $runEnd) {
+                    if ($run !== '') {
+                        \FFI::memcpy($bytes + $runStart, $run, strlen($run));
+                    }
+                    $run = '';
+                    $runStart = $offset;
+                }
+                $run .= $packed[$key] ??= pack('N', $key);
+                $runEnd = $offset + 4;
+                continue;
+            }
+            // 其他命令之前先写出已合并的像素，保持绘制顺序
+            if ($run !== '') {
+                \FFI::memcpy($bytes + $runStart, $run, strlen($run));
+                $run = '';
+                $runEnd = -1;
+            }
+            switch ($op) {
+                case self::PIXEL:
+                    $ffi->ImageDrawPixel($image, $a, $b, $structs[$key]);
+                    break;
+                case self::LINE:
+                    $ffi->ImageDrawLine($image, $a, $b, $c, $d, $structs[$key]);
+                    break;
+                case self::RECTANGLE:
+                    $ffi->ImageDrawRectangle($image, $a, $b, $c, $d, $structs[$key]);
+                    break;
+                case self::RECTANGLE_LINES:
+                    $rec->x = $a;
+                    $rec->y = $b;
+                    $rec->width = $c;
+                    $rec->height = $d;
+                    $ffi->ImageDrawRectangleLines($image, $rec, $e, $structs[$key]);
+                    break;
+                case self::CIRCLE:
+                    $ffi->ImageDrawCircle($image, $a, $b, $c, $structs[$key]);
+                    break;
+                case self::CIRCLE_LINES:
+                    $ffi->ImageDrawCircleLines($image, $a, $b, $c, $structs[$key]);
+                    break;
+            }
+        }
+        if ($run !== '') {
+            \FFI::memcpy($bytes + $runStart, $run, strlen($run));
+        }
+    }
+
+    /**
+     * 清空命令
+     *
+     * @return void
+     */
+    public function clear(): void
+    {
+        $this->commands = [];
+        $this->colors = [];
+    }
+
+    /**
+     * 命令数量
+     *
+     * @return integer
+     */
+    public function count(): int
+    {
+        return count($this->commands);
+    }
+
+    /**
+     * 颜色键（RGBA 按字节顺序组成的 32 位整数），同一颜色只保存一次
+     *
+     * @param Color $color 颜色
+     * @return integer
+     */
+    private function color(Color $color): int
+    {
+        $struct = $color->cdata();
+        $key = ($struct->r << 24) | ($struct->g << 16) | ($struct->b << 8) | $struct->a;
+        $this->colors[$key] ??= [$struct->r, $struct->g, $struct->b, $struct->a];
+        return $key;
+    }
+}
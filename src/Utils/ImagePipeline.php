@@ -0,0 +1,290 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use Kingbes\Raylib\Core;
+use Kingbes\Raylib\Textures;
+
+/**
+ * 批量图像处理流水线
+ *
+ * 用 Core::loadDirectoryFilesEx() 列出目录中的图像，对每个文件执行
+ * 解码（loadImage）→ 变换（transform() 注册的操作）→ 编码（exportImage）。
+ * 文件由父进程逐个派发给 pcntl_fork() 的子进程，每个子进程同时只持有一张图像，
+ * 不同子进程的解码、变换、编码相互重叠，内存上限约为 进程数 × 单张图像大小。
+ * 不支持多进程时（缺少 pcntl、Windows、workers 为 1，或窗口/音频设备已初始化）在当前进程顺序执行。
+ */
+class ImagePipeline extends Base
+{
+    // 流水线阶段
+    public const STAGES = ['decode', 'transform', 'encode'];
+
+    private int $workers;
+    private array $transforms = [];
+
+    /**
+     * 批量图像处理流水线
+     *
+     * @param integer $workers 子进程数量
+     * @return void
+     */
+    public function __construct(int $workers = 4)
+    {
+        $this->workers = max(1, $workers);
+    }
+
+    /**
+     * 追加变换操作，按注册顺序执行
+     *
+     * 操作在子进程中执行，不能依赖在父进程中修改的状态。
+     *
+     * @param \Closure $transform 对图像原地执行的操作，参数为 Image
+     * @return static
+     */
+    public function transform(\Closure $transform): static
+    {
+        $this->transforms[] = $transform;
+        return $this;
+    }
+
+    /**
+     * 处理目录中的全部图像
+     *
+     * 输出文件保持输入目录的相对路径，$extension 不为 null 时替换扩展名（决定导出格式）。
+     *
+     * 返回的报告：
+     * - files / failed：成功数量和失败的输入路径
+     * - seconds：总耗时，filesPerSecond：整体吞吐
+     * - stages：每个阶段的 seconds（所有进程累计耗时）和 filesPerSecond（按进程数折算的阶段吞吐）
+     * - bytesIn / bytesOut：输入和输出文件总字节数
+     *
+     * @param string $inputDir 输入目录
+     * @param string $outputDir 输出目录
+     * @param string $filter 扩展名过滤，如 '.png;.jpg'
+     * @param boolean $recursive 是否递归子目录
+     * @param string|null $extension 输出扩展名，如 '.png'
+     * @return array 处理报告
+     * @throws \RuntimeException 如果无法创建子进程
+     */
+    public function run(
+        string $inputDir,
+        string $outputDir,
+        string $filter = '.png;.bmp;.tga;.jpg;.gif;.qoi;.psd;.hdr',
+        bool $recursive = true,
+        ?string $extension = null
+    ): array {
+        $list = Core::loadDirectoryFilesEx($inputDir, $filter, $recursive);
+        $files = $list->toArray();
+        Core::unloadDirectoryFiles($list);
+
+        $base = rtrim(str_replace('\\', '/', $inputDir), '/') . '/';
+        $jobs = [];
+        foreach ($files as $file) {
+            $relative = str_starts_with(str_replace('\\', '/', $file), $base)
+                ? substr(str_replace('\\', '/', $file), strlen($base))
+                : basename($file);
+            if ($extension !== null) {
+                $relative = preg_replace('/\.[^.\/]*$/', '', $relative) . $extension;
+            }
+            $jobs[] = [$file, rtrim($outputDir, '/\\') . '/' . $relative];
+        }
+
+        $report = [
+            'files' => 0,
+            'failed' => [],
+            'seconds' => 0.0,
+            'filesPerSecond' => 0.0,
+            'stages' => array_fill_keys(self::STAGES, ['seconds' => 0.0, 'filesPerSecond' => 0.0]),
+            'bytesIn' => 0,
+            'bytesOut' => 0,
+        ];
+        $workers = min($this->workers, count($jobs));
+
+        $start = hrtime(true);
+        if ($workers < 2 || !ImageWorkerPool::supported() || !function_exists('stream_socket_pair')) {
+            $workers = 1;
+            foreach ($jobs as $i => [$src, $dst]) {
+                $this->collect($report, $jobs, $this->process($i, $src, $dst));
+            }
+        } else {
+            $this->dispatch($jobs, $workers, $report);
+        }
+        $report['seconds'] = (hrtime(true) - $start) / 1e9;
+
+        $report['filesPerSecond'] = $report['seconds'] > 0 ? $report['files'] / $report['seconds'] : 0.0;
+        foreach (self::STAGES as $stage) {
+            $seconds = $report['stages'][$stage]['seconds'];
+            $report['stages'][$stage]['filesPerSecond'] = $seconds > 0 ? count($jobs) * $workers / $seconds : 0.0;
+        }
+        return $report;
+    }
+
+    /**
+     * 派发任务给子进程：每个子进程同时只有一个任务，完成一个再发下一个
+     *
+     * @param array $jobs 任务 [输入路径, 输出路径]
+     * @param integer $workers 子进程数量
+     * @param array $report 处理报告
+     * @return void
+     * @throws \RuntimeException 如果无法创建子进程
+     */
+    private function dispatch(array $jobs, int $workers, array &$report): void
+    {
+        $sockets = [];
+        $pids = [];
+        for ($w = 0; $w < $workers; $w++) {
+            $pair = stream_socket_pair(STREAM_PF_UNIX, STREAM_SOCK_STREAM, STREAM_IPPROTO_IP);
+            $pid = $pair === false ? -1 : pcntl_fork();
+            if ($pid === -1) {
+                foreach ($sockets as $socket) {
+                    fclose($socket);
+                }
+                throw new \RuntimeException("Unable to start image pipeline worker");
+            }
+            if ($pid === 0) {
+                fclose($pair[0]);
+                foreach ($sockets as $socket) {
+                    fclose($socket);
+                }
+                $this->work($pair[1], $jobs);
+            }
+            fclose($pair[1]);
+            $sockets[$w] = $pair[0];
+            $pids[$w] = $pid;
+        }
+
+        $next = 0;
+        $inflight = []; // 子进程 => 正在处理的任务序号
+        foreach ($sockets as $w => $socket) {
+            if ($next < count($jobs)) {
+                fwrite($socket, $next . "\n");
+                $inflight[$w] = $next++;
+            }
+        }
+        while ($inflight) {
+            $read = array_intersect_key($sockets, $inflight);
+            $write = $except = null;
+            if (stream_select($read, $write, $except, null) === false) {
+                break;
+            }
+            foreach ($read as $w => $socket) {
+                $line = fgets($socket);
+                if ($line === false) {
+                    // 子进程异常退出，它的任务记为失败，剩余任务交给其他进程
+                    $report['failed'][] = $jobs[$inflight[$w]][0];
+                    unset($inflight[$w]);
+                    fclose($socket);
+                    unset($sockets[$w]);
+                    continue;
+                }
+                $this->collect($report, $jobs, json_decode($line, true));
+                unset($inflight[$w]);
+                if ($next < count($jobs)) {
+                    fwrite($socket, $next . "\n");
+                    $inflight[$w] = $next++;
+                }
+            }
+        }
+        // 没有可用的子进程时剩下的任务记为失败
+        foreach ($inflight as $index) {
+            $report['failed'][] = $jobs[$index][0];
+        }
+        for (; $next < count($jobs); $next++) {
+            $report['failed'][] = $jobs[$next][0];
+        }
+
+        foreach ($sockets as $socket) {
+            fclose($socket);
+        }
+        foreach ($pids as $pid) {
+            pcntl_waitpid($pid, $status);
+        }
+    }
+
+    /**
+     * 子进程：读取任务序号，处理后返回一行 JSON 结果，父进程关闭连接时退出
+     *
+     * @param resource $socket 与父进程的连接
+     * @param array $jobs 任务 [输入路径, 输出路径]
+     * @return never
+     */
+    private function work($socket, array $jobs): never
+    {
+        while (($line = fgets($socket)) !== false) {
+            $i = (int)$line;
+            fwrite($socket, json_encode($this->process($i, $jobs[$i][0], $jobs[$i][1])) . "\n");
+        }
+        ImageWorkerPool::terminate(0);
+    }
+
+    /**
+     * 处理一个文件：解码、变换、编码，分别计时
+     *
+     * @param integer $index 任务序号
+     * @param string $src 输入路径
+     * @param string $dst 输出路径
+     * @return array 结果
+     */
+    private function process(int $index, string $src, string $dst): array
+    {
+        $result = ['index' => $index, 'ok' => false, 'decode' => 0, 'transform' => 0, 'encode' => 0, 'bytesOut' => 0];
+        $image = null;
+        try {
+            $t = hrtime(true);
+            $image = Textures::loadImage($src);
+            $result['decode'] = hrtime(true) - $t;
+            if (!Textures::isImageValid($image)) {
+                return $result;
+            }
+
+            $t = hrtime(true);
+            foreach ($this->transforms as $transform) {
+                $transform($image);
+            }
+            $result['transform'] = hrtime(true) - $t;
+
+            $t = hrtime(true);
+            $dir = dirname($dst);
+            if (!is_dir($dir)) {
+                @mkdir($dir, 0777, true);
+            }
+            $result['ok'] = Textures::exportImage($image, $dst);
+            $result['encode'] = hrtime(true) - $t;
+            $result['bytesOut'] = $result['ok'] ? (int)@filesize($dst) : 0;
+        } catch (\Throwable) {
+            $result['ok'] = false;
+        } finally {
+            if ($image !== null) {
+                Textures::unloadImage($image);
+            }
+        }
+        return $result;
+    }
+
+    /**
+     * 汇总一个文件的结果
+     *
+     * @param array $report 处理报告
+     * @param array $jobs 任务 [输入路径, 输出路径]
+     * @param array $result 结果
+     * @return void
+     */
+    private function collect(array &$report, array $jobs, array $result): void
+    {
+        $src = $jobs[$result['index']][0];
+        foreach (self::STAGES as $stage) {
+            $report['stages'][$stage]['seconds'] += $result[$stage] / 1e9;
+        }
+        if ($result['ok']) {
+            $report['files']++;
+            $report['bytesIn'] += (int)@filesize($src);
+            $report['bytesOut'] += $result['bytesOut'];
+        } else {
+            $report['failed'][] = $src;
+        }
+    }
+}
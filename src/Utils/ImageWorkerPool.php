@@ -0,0 +1,209 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use \FFI\CData;
+
+/**
+ * 图像分块并行处理
+ *
+ * PHP 没有线程，这里用 pcntl_fork() 的子进程代替线程池：图像按行切成若干块，
+ * 每个子进程对自己的块（上下多带 halo 行）调用 raylib 的单线程函数，
+ * 结果写回父进程用 mmap(MAP_SHARED) 分配的共享内存，父进程再换成 raylib 分配的像素数据。
+ * fork 只复制调用线程：InitWindow() 后的 GL 驱动线程和 InitAudioDevice() 后的 miniaudio 线程不会被复制，
+ * 它们持有的 malloc/驱动锁会让子进程死锁，因此窗口或音频设备初始化之后 supported() 返回 false，不再 fork。
+ *
+ * 只适用于每个输出像素只依赖其 halo 范围内输入像素的操作（逐像素颜色运算、卷积等），
+ * 这样结果与整幅图像一次处理完全相同。缺少 pcntl 或 mmap（如 Windows）时返回 false，由调用方在当前进程处理。
+ */
+class ImageWorkerPool extends Base
+{
+    // 头文件模块（ImageFromImage 等在 textures，MemAlloc 在 core）
+    protected const MODULE = ['textures', 'core'];
+
+    // 每个子进程至少处理的行数，块太小时 fork 的开销超过收益
+    public const MIN_ROWS = 64;
+
+    private int $workers;
+
+    /**
+     * 图像分块并行处理
+     *
+     * @param integer $workers 子进程数量
+     * @return void
+     */
+    public function __construct(int $workers)
+    {
+        $this->workers = max(1, $workers);
+    }
+
+    /**
+     * 当前环境是否支持多进程分块处理
+     *
+     * @return boolean
+     */
+    public static function supported(): bool
+    {
+        if (
+            PHP_OS_FAMILY === 'Windows'
+            || !function_exists('pcntl_fork')
+            || !function_exists('pcntl_waitpid')
+            || LibC::get() === null
+        ) {
+            return false;
+        }
+        try {
+            return !self::threadsStarted();
+        } catch (\RuntimeException) {
+            // 没有解析 core 模块（MemAlloc/MemFree），只能在当前进程处理
+            return false;
+        }
+    }
+
+    /**
+     * raylib 是否已经启动了后台线程（窗口或音频设备已初始化），此时 fork 不安全
+     *
+     * @return boolean
+     */
+    public static function threadsStarted(): bool
+    {
+        if (self::ffi()->IsWindowReady()) {
+            return true;
+        }
+        try {
+            return \Kingbes\Raylib\Audio::ffi()->IsAudioDeviceReady();
+        } catch (\RuntimeException) {
+            // 没有解析 audio 模块，也就不可能初始化过音频设备
+            return false;
+        }
+    }
+
+    /**
+     * 按行分块并行执行图像操作
+     *
+     * @param Image $image 图像（原地修改）
+     * @param integer $halo 每块上下额外带上的行数
+     * @param \Closure $kernel 对一块图像原地执行的操作，参数为 Image
+     * @return boolean 是否已并行处理，false 表示图像太小或太大、只有一个进程或环境不支持，图像未被修改
+     * @throws \RuntimeException 如果子进程失败
+     */
+    public function run(Image $image, int $halo, \Closure $kernel): bool
+    {
+        $width = $image->width;
+        $height = $image->height;
+        $workers = min($this->workers, intdiv($height, self::MIN_ROWS));
+        if ($workers < 2 || $image->mipmaps > 1 || !self::supported()) {
+            return false;
+        }
+
+        $ffi = self::ffi();
+        $libc = LibC::get();
+
+        // 先处理一行，得到输出格式（操作可能改变像素格式，如转灰度）
+        $probe = new Image($ffi->ImageFromImage($image->struct(), self::rect(0, 0, $width, 1)));
+        $kernel($probe);
+        $format = $probe->format;
+        $ffi->UnloadImage($probe->struct());
+        $rowBytes = $ffi->GetPixelDataSize($width, 1, $format);
+        $size = $rowBytes * $height;
+        if ($size > Image::MAX_DATA_SIZE) {
+            // 结果无法用 MemAlloc() 分配
+            return false;
+        }
+
+        $shared = $libc->mmap(null, $size, LibC::PROT_READ | LibC::PROT_WRITE, LibC::MAP_SHARED | LibC::mapAnonymous(), -1, 0);
+        if (LibC::mapFailed($shared)) {
+            return false;
+        }
+
+        try {
+            $rows = (int)ceil($height / $workers);
+            $pids = [];
+            for ($y0 = 0; $y0 < $height; $y0 += $rows) {
+                $y1 = min($height, $y0 + $rows);
+                $pid = pcntl_fork();
+                if ($pid === -1) {
+                    throw new \RuntimeException("Unable to fork image worker");
+                }
+                if ($pid === 0) {
+                    $status = 1;
+                    try {
+                        $top = min($halo, $y0);
+                        $bottom = min($halo, $height - $y1);
+                        $tile = new Image($ffi->ImageFromImage(
+                            $image->struct(),
+                            self::rect(0, $y0 - $top, $width, $y1 - $y0 + $top + $bottom)
+                        ));
+                        $kernel($tile);
+                        if ($tile->format === $format && $tile->width === $width) {
+                            \FFI::memcpy(
+                                $ffi->cast('unsigned char *', $shared) + $y0 * $rowBytes,
+                                $ffi->cast('unsigned char *', $tile->struct()->data) + $top * $rowBytes,
+                                ($y1 - $y0) * $rowBytes
+                            );
+                            $status = 0;
+                        }
+                    } finally {
+                        self::terminate($status);
+                    }
+                }
+                $pids[] = $pid;
+            }
+
+            $failed = false;
+            foreach ($pids as $pid) {
+                pcntl_waitpid($pid, $status);
+                $failed = $failed || !pcntl_wifexited($status) || pcntl_wexitstatus($status) !== 0;
+            }
+            if ($failed) {
+                throw new \RuntimeException("Image worker failed");
+            }
+
+            // 换成 raylib 分配的像素数据，UnloadImage() 可以正常释放
+            $target = $image->pointer();
+            $data = $ffi->MemAlloc($size);
+            \FFI::memcpy($data, $shared, $size);
+            $ffi->MemFree($target->data);
+            $target->data = $data;
+            $target->format = $format;
+            return true;
+        } finally {
+            $libc->munmap($shared, $size);
+        }
+    }
+
+    /**
+     * 结束子进程，跳过从父进程继承的对象析构和关闭函数
+     *
+     * @param integer $status 退出码
+     * @return never
+     */
+    public static function terminate(int $status): never
+    {
+        LibC::get()->_exit($status);
+        exit($status);
+    }
+
+    /**
+     * 构造矩形结构体
+     *
+     * @param integer $x 横坐标
+     * @param integer $y 纵坐标
+     * @param integer $width 宽度
+     * @param integer $height 高度
+     * @return CData
+     */
+    private static function rect(int $x, int $y, int $width, int $height): CData
+    {
+        $rec = self::ffi()->new('Rectangle');
+        $rec->x = $x;
+        $rec->y = $y;
+        $rec->width = $width;
+        $rec->height = $height;
+        return $rec;
+    }
+}
@@ -0,0 +1,72 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+/**
+ * C 标准库/POSIX 函数
+ *
+ * 共享内存、文件映射和子进程退出用到的少量 libc 函数，Windows 下不可用。
+ */
+final class LibC
+{
+    public const PROT_READ = 0x1;
+    public const PROT_WRITE = 0x2;
+    public const MAP_SHARED = 0x01;
+    public const MAP_PRIVATE = 0x02;
+    public const O_RDONLY = 0;
+
+    private static ?\FFI $ffi = null;
+
+    /**
+     * 获取 libc FFI 实例
+     *
+     * @return \FFI|null 不可用时返回 null
+     */
+    public static function get(): ?\FFI
+    {
+        if (self::$ffi === null && PHP_OS_FAMILY !== 'Windows') {
+            try {
+                self::$ffi = \FFI::cdef('
+                    void *mmap(void *addr, size_t length, int prot, int flags, int fd, long offset);
+                    int munmap(void *addr, size_t length);
+                    int open(const char *pathname, int flags);
+                    int close(int fd);
+                    void _exit(int status);
+                ');
+            } catch (\FFI\Exception) {
+                return null;
+            }
+        }
+        return self::$ffi;
+    }
+
+    /**
+     * MAP_ANONYMOUS 的值随系统不同
+     *
+     * @return integer
+     */
+    public static function mapAnonymous(): int
+    {
+        return PHP_OS_FAMILY === 'Darwin' ? 0x1000 : 0x20;
+    }
+
+    /**
+     * mmap() 是否失败（返回 MAP_FAILED 即 (void *)-1）
+     *
+     * void * 直接转成整数类型时 FFI 会自动解引用（读映射区的内容），
+     * 所以先转成 char *，再把指针值本身按 intptr_t 解释
+     *
+     * @param \FFI\CData $address mmap() 的返回值
+     * @return boolean
+     */
+    public static function mapFailed(\FFI\CData $address): bool
+    {
+        if (\FFI::isNull($address)) {
+            return true;
+        }
+        return \FFI::cast('intptr_t', \FFI::cast('char *', $address))->cdata === -1;
+    }
+}
@@ -0,0 +1,168 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\PixelFormat;
+use \FFI\CData;
+
+/**
+ * 内存映射图像
+ *
+ * 未压缩的 RAW 像素文件用 mmap(MAP_PRIVATE) 映射，Image.data 直接指向映射区，
+ * 不读入堆内存，只有实际访问到的页才占用物理内存。
+ * 通过像素视图写入时由系统按页写时复制，不会改动文件。
+ * 需要 raylib 原地修改（缩放、裁剪、转换格式等可能重新分配像素数据）时，
+ * pointer() 先把像素复制到 raylib 分配的内存（提升），之后与普通 Image 相同。
+ *
+ * 必须用 Textures::unloadImage() 或 unload() 释放，不能把映射区交给 raylib 的 UnloadImage()。
+ */
+class MappedImage extends Image
+{
+    // 头文件模块（MemAlloc/MemFree）
+    protected const MODULE = 'core';
+
+    private ?CData $mapping = null; // 映射区起始地址
+    private int $mappingSize = 0;
+
+    /**
+     * 映射 RAW 像素文件
+     *
+     * @param string $fileName 文件名
+     * @param integer $width 宽度
+     * @param integer $height 高度
+     * @param integer $format 像素格式（仅未压缩格式）
+     * @param integer $headerSize 文件头字节数
+     * @return MappedImage
+     * @throws \InvalidArgumentException 如果格式是压缩格式或文件小于像素数据
+     * @throws \RuntimeException 如果系统不支持或映射失败
+     */
+    public static function open(string $fileName, int $width, int $height, int $format, int $headerSize = 0): self
+    {
+        $libc = LibC::get();
+        if ($libc === null) {
+            throw new \RuntimeException("Memory-mapped images are not supported on " . PHP_OS_FAMILY);
+        }
+        if (PixelFormat::tryFrom($format)?->isCompressed() !== false) {
+            throw new \InvalidArgumentException("Only uncompressed pixel formats can be mapped: " . $format);
+        }
+        $dataSize = self::dataSize($width, $height, $format);
+        $fileSize = @filesize($fileName);
+        if ($fileSize === false || $fileSize < $headerSize + $dataSize) {
+            throw new \InvalidArgumentException("Raw image file is smaller than " . ($headerSize + $dataSize) . " bytes: " . $fileName);
+        }
+
+        $fd = $libc->open($fileName, LibC::O_RDONLY);
+        if ($fd < 0) {
+            throw new \RuntimeException("Unable to open raw image file: " . $fileName);
+        }
+        $size = $headerSize + $dataSize;
+        $mapping = $libc->mmap(null, $size, LibC::PROT_READ | LibC::PROT_WRITE, LibC::MAP_PRIVATE, $fd, 0);
+        $libc->close($fd);
+        if (LibC::mapFailed($mapping)) {
+            throw new \RuntimeException("Unable to map raw image file: " . $fileName);
+        }
+
+        $cdata = self::ffi()->new('Image');
+        $cdata->data = self::ffi()->cast('unsigned char *', $mapping) + $headerSize;
+        $cdata->width = $width;
+        $cdata->height = $height;
+        $cdata->mipmaps = 1;
+        $cdata->format = $format;
+
+        $image = new self($cdata);
+        $image->mapping = $mapping;
+        $image->mappingSize = $size;
+        return $image;
+    }
+
+    /**
+     * 像素数据是否仍在映射区中（尚未提升）
+     *
+     * @return boolean
+     */
+    public function isMapped(): bool
+    {
+        return $this->mapping !== null;
+    }
+
+    /**
+     * 指向图像结构体的指针，交给 raylib 原地修改前先提升到 raylib 分配的内存
+     *
+     * @return CData
+     * @throws \RuntimeException 如果像素数据超过 Image::MAX_DATA_SIZE，无法提升
+     */
+    public function pointer(): CData
+    {
+        $this->promote();
+        return parent::pointer();
+    }
+
+    /**
+     * 把像素复制到 raylib 分配的内存并解除映射
+     *
+     * 像素数据超过 Image::MAX_DATA_SIZE（2GB）时 raylib 无法分配和处理，图像保持映射，
+     * 只能通过 pixels() 读写，不能交给 raylib 原地修改。
+     *
+     * @return void
+     * @throws \RuntimeException 如果像素数据超过 Image::MAX_DATA_SIZE
+     */
+    public function promote(): void
+    {
+        if ($this->mapping === null) {
+            return;
+        }
+        $cdata = $this->struct();
+        $size = self::dataSize($cdata->width, $cdata->height, $cdata->format);
+        if ($size > self::MAX_DATA_SIZE) {
+            throw new \RuntimeException("Mapped image data of " . $size . " bytes is too large for raylib, use pixels() instead");
+        }
+        $data = self::ffi()->MemAlloc($size);
+        \FFI::memcpy($data, $cdata->data, $size);
+        $cdata->data = $data;
+        $this->unmap();
+    }
+
+    /**
+     * 释放像素数据（映射区或提升后的内存）
+     *
+     * @return void
+     */
+    public function unload(): void
+    {
+        $cdata = $this->struct();
+        if ($this->mapping !== null) {
+            $this->unmap();
+        } elseif (!\FFI::isNull($cdata->data)) {
+            self::ffi()->MemFree($cdata->data);
+        }
+        $cdata->data = null;
+    }
+
+    /**
+     * 像素数据字节数（按 PHP 整数计算，超过 2GB 的图像也不会溢出）
+     *
+     * @param integer $width 宽度
+     * @param integer $height 高度
+     * @param integer $format 像素格式
+     * @return integer
+     */
+    private static function dataSize(int $width, int $height, int $format): int
+    {
+        return intdiv($width * $height * PixelFormat::from($format)->bitsPerPixel(), 8);
+    }
+
+    /**
+     * 解除映射
+     *
+     * @return void
+     */
+    private function unmap(): void
+    {
+        LibC::get()->munmap($this->mapping, $this->mappingSize);
+        $this->mapping = null;
+        $this->mappingSize = 0;
+    }
+}
@@ -10,18 +10,16 @@ use \FFI\CData;
 
 /**
  * 矩阵对象
- * 
- * @property array<float> $firstRow 第一行 4 个元素
- * @property array<float> $secondRow 第二行 4 个元素
- * @property array<float> $thirdRow 第三行 4 个元素
- * @property array<float> $fourthRow 第四行 4 个元素
+ *
+ * 数据保存在一个 raylib Matrix 结构体中（16 个 float，列主序，m0..m3 为第一列），
+ * 链式变换的结果直接沿用 raylib 返回的结构体，读取元素前不会拆成 PHP 数组。
  */
 class Matrix extends Base
 {
-    private array $firstRow;
-    private array $secondRow;
-    private array $thirdRow;
-    private array $fourthRow;
+    private CData $data; // struct Matrix
+    private CData $floats; // 同一块内存的 float[16] 视图，按行存放
+
+    private static \ReflectionClass $reflection;
 
     /**
      * 矩阵对象
@@ -38,36 +36,98 @@ class Matrix extends Base
         array $thirdRow,
         array $fourthRow
     ) {
-        $this->firstRow = $firstRow;
-        $this->secondRow = $secondRow;
-        $this->thirdRow = $thirdRow;
-        $this->fourthRow = $fourthRow;
+        $this->attach(self::ffi()->new('struct Matrix'));
+        foreach ([$firstRow, $secondRow, $thirdRow, $fourthRow] as $row => $values) {
+            for ($col = 0; $col < 4; $col++) {
+                $this->floats[$row * 4 + $col] = $values[$col];
+            }
+        }
+    }
+
+    /**
+     * 直接使用 raylib 返回的矩阵结构体，不复制
+     *
+     * @param CData $cdata 矩阵结构体
+     * @return Matrix
+     */
+    public static function fromStruct(CData $cdata): self
+    {
+        self::$reflection ??= new \ReflectionClass(self::class);
+        $matrix = self::$reflection->newInstanceWithoutConstructor();
+        $matrix->attach($cdata);
+        return $matrix;
+    }
+
+    /**
+     * 读取元素
+     *
+     * @param integer $row 行 0-3
+     * @param integer $col 列 0-3
+     * @return float
+     */
+    public function get(int $row, int $col): float
+    {
+        return $this->floats[$row * 4 + $col];
+    }
+
+    /**
+     * 修改元素
+     *
+     * @param integer $row 行 0-3
+     * @param integer $col 列 0-3
+     * @param float $value 值
+     * @return void
+     */
+    public function set(int $row, int $col, float $value): void
+    {
+        $this->floats[$row * 4 + $col] = $value;
+    }
+
+    /**
+     * 按行转为数组
+     *
+     * @return array<array<float>> 4 行，每行 4 个元素
+     */
+    public function toArray(): array
+    {
+        $rows = [];
+        for ($i = 0; $i < 16; $i++) {
+            $rows[$i >> 2][] = $this->floats[$i];
+        }
+        return $rows;
     }
 
     /**
      * 矩阵对象结构体
      *
+     * 返回对象自身持有的结构体，不会重新分配
+     *
      * @return CData
      */
     public function struct(): CData
     {
-        $matrix = self::ffi()->new('struct Matrix');
-        $matrix->m0 = $this->firstRow[0];
-        $matrix->m1 = $this->firstRow[1];
-        $matrix->m2 = $this->firstRow[2];
-        $matrix->m3 = $this->firstRow[3];
-        $matrix->m4 = $this->secondRow[0];
-        $matrix->m5 = $this->secondRow[1];
-        $matrix->m6 = $this->secondRow[2];
-        $matrix->m7 = $this->secondRow[3];
-        $matrix->m8 = $this->thirdRow[0];
-        $matrix->m9 = $this->thirdRow[1];
-        $matrix->m10 = $this->thirdRow[2];
-        $matrix->m11 = $this->thirdRow[3];
-        $matrix->m12 = $this->fourthRow[0];
-        $matrix->m13 = $this->fourthRow[1];
-        $matrix->m14 = $this->fourthRow[2];
-        $matrix->m15 = $this->fourthRow[3];
-        return $matrix;
+        return $this->data;
+    }
+
+    /**
+     * 复制对象时复制结构体，避免共用同一块内存
+     *
+     * @return void
+     */
+    public function __clone(): void
+    {
+        $this->attach(clone $this->data);
+    }
+
+    /**
+     * 绑定结构体及其 float 视图
+     *
+     * @param CData $cdata 矩阵结构体
+     * @return void
+     */
+    private function attach(CData $cdata): void
+    {
+        $this->data = $cdata;
+        $this->floats = self::ffi()->cast('float[16]', $cdata);
     }
 }
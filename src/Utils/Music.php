@@ -21,13 +21,42 @@ class Music extends Base
     public bool $looping;
     public readonly int $ctxType;
     private CData $data;
+    private ?CData $source; // 从内存加载时解码器读取的数据，卸载前必须保持有效
 
-    public function __construct(CData $cdata)
+    /**
+     * 音乐对象
+     *
+     * @param CData $cdata 音乐结构体
+     * @param CData|null $source 从内存加载时的数据缓冲区，随对象一起释放
+     * @return void
+     */
+    public function __construct(CData $cdata, ?CData $source = null)
     {
         $this->frameCount = $cdata->frameCount;
         $this->looping = $cdata->looping;
         $this->ctxType = $cdata->ctxType;
         $this->data = $cdata;
+        $this->source = $source;
+    }
+
+    /**
+     * 从内存加载时持有的数据字节数
+     *
+     * @return integer
+     */
+    public function sourceSize(): int
+    {
+        return $this->source === null ? 0 : \FFI::sizeof($this->source);
+    }
+
+    /**
+     * 释放从内存加载时持有的数据（UnloadMusicStream() 之后调用）
+     *
+     * @return void
+     */
+    public function releaseSource(): void
+    {
+        $this->source = null;
     }
 
     /**
@@ -0,0 +1,367 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use Kingbes\Raylib\PixelFormat;
+use \FFI\CData;
+
+/**
+ * 图像像素视图
+ *
+ * 直接读写 Image.data 指向的像素内存，不复制、不经过 Color 对象。
+ * 按像素格式解释为对应的元素类型：8 位格式为 uint8_t，R32 系列为 float，
+ * 16 位打包格式和半精度 float（R16 系列）为原始的 uint16_t。
+ * 单个像素读写都做边界检查，批量的填充、复制、拷贝按行 memcpy。
+ *
+ * 图像尺寸或格式改变后（缩放、裁剪、转换格式等）像素内存会重新分配，
+ * 之后再通过旧视图读写会抛出 LogicException，需要用 pixels() 重新获取视图。
+ */
+class PixelView extends Base
+{
+    public readonly int $width; // 宽度（像素）
+    public readonly int $height; // 高度（像素）
+    public readonly int $format; // 像素格式
+    public readonly int $channels; // 每像素元素数
+    public readonly int $pixelSize; // 每像素字节数
+    public readonly int $stride; // 每行字节数
+
+    private CData $elements; // 按元素类型的指针
+    private CData $bytes; // uint8_t 指针
+    private Image $image; // 保持图像对象存活
+    private CData $struct; // 图像结构体，用来发现像素内存已被重新分配
+
+    /**
+     * 图像像素视图
+     *
+     * @param Image $image 图像对象
+     * @return void
+     * @throws \InvalidArgumentException 如果是压缩格式或没有像素数据
+     */
+    public function __construct(Image $image)
+    {
+        $layout = PixelFormat::tryFrom($image->format)?->layout();
+        if ($layout === null) {
+            throw new \InvalidArgumentException("Unsupported pixel format for pixel view: " . $image->format);
+        }
+        $data = $image->struct()->data;
+        if (\FFI::isNull($data)) {
+            throw new \InvalidArgumentException("Image has no pixel data");
+        }
+        [$type, $size, $channels] = $layout;
+        $this->image = $image;
+        $this->struct = $image->struct();
+        $this->width = $image->width;
+        $this->height = $image->height;
+        $this->format = $image->format;
+        $this->channels = $channels;
+        $this->pixelSize = $size * $channels;
+        $this->stride = $this->pixelSize * $this->width;
+        $this->elements = self::ffi()->cast($type . ' *', $data);
+        $this->bytes = self::ffi()->cast('uint8_t *', $data);
+    }
+
+    /**
+     * 读取像素的一个通道
+     *
+     * @param integer $x 横坐标
+     * @param integer $y 纵坐标
+     * @param integer $channel 通道
+     * @return integer|float
+     * @throws \OutOfRangeException 如果坐标或通道越界
+     */
+    public function get(int $x, int $y, int $channel = 0): int|float
+    {
+        return $this->elements[$this->index($x, $y, $channel)];
+    }
+
+    /**
+     * 修改像素的一个通道
+     *
+     * @param integer $x 横坐标
+     * @param integer $y 纵坐标
+     * @param integer|float $value 值
+     * @param integer $channel 通道
+     * @return void
+     * @throws \OutOfRangeException 如果坐标或通道越界
+     */
+    public function set(int $x, int $y, int|float $value, int $channel = 0): void
+    {
+        $this->elements[$this->index($x, $y, $channel)] = $value;
+    }
+
+    /**
+     * 读取像素的全部通道
+     *
+     * @param integer $x 横坐标
+     * @param integer $y 纵坐标
+     * @return array<int|float>
+     * @throws \OutOfRangeException 如果坐标越界
+     */
+    public function getPixel(int $x, int $y): array
+    {
+        $index = $this->index($x, $y, 0);
+        $values = [];
+        for ($c = 0; $c < $this->channels; $c++) {
+            $values[] = $this->elements[$index + $c];
+        }
+        return $values;
+    }
+
+    /**
+     * 修改像素的全部通道
+     *
+     * @param integer $x 横坐标
+     * @param integer $y 纵坐标
+     * @param integer|float ...$values 各通道的值
+     * @return void
+     * @throws \OutOfRangeException 如果坐标越界
+     * @throws \InvalidArgumentException 如果通道数不符
+     */
+    public function setPixel(int $x, int $y, int|float ...$values): void
+    {
+        $this->checkValues($values);
+        $index = $this->index($x, $y, 0);
+        foreach ($values as $c => $value) {
+            $this->elements[$index + $c] = $value;
+        }
+    }
+
+    /**
+     * 用同一个像素值填充整幅图像
+     *
+     * @param integer|float ...$values 各通道的值
+     * @return void
+     * @throws \InvalidArgumentException 如果通道数不符
+     */
+    public function fill(int|float ...$values): void
+    {
+        $this->fillRect(0, 0, $this->width, $this->height, ...$values);
+    }
+
+    /**
+     * 用同一个像素值填充矩形区域，超出图像的部分被裁掉
+     *
+     * 先写一个像素，按倍增 memcpy 铺满第一行，再把第一行 memcpy 到其余各行。
+     *
+     * @param integer $x 左上角横坐标
+     * @param integer $y 左上角纵坐标
+     * @param integer $width 宽度
+     * @param integer $height 高度
+     * @param integer|float ...$values 各通道的值
+     * @return void
+     * @throws \InvalidArgumentException 如果通道数不符
+     */
+    public function fillRect(int $x, int $y, int $width, int $height, int|float ...$values): void
+    {
+        $this->checkValues($values);
+        $this->check();
+        [$x, $y, $width, $height] = $this->clip($x, $y, $width, $height);
+        if ($width <= 0 || $height <= 0) {
+            return;
+        }
+
+        $first = ($y * $this->width + $x) * $this->channels;
+        foreach ($values as $c => $value) {
+            $this->elements[$first + $c] = $value;
+        }
+        $row = $this->bytes + ($y * $this->stride + $x * $this->pixelSize);
+        $rowBytes = $width * $this->pixelSize;
+        for ($filled = $this->pixelSize; $filled < $rowBytes; $filled *= 2) {
+            \FFI::memcpy($row + $filled, $row, min($filled, $rowBytes - $filled));
+        }
+        for ($i = 1; $i < $height; $i++) {
+            \FFI::memcpy($row + $i * $this->stride, $row, $rowBytes);
+        }
+    }
+
+    /**
+     * 从同格式的视图拷贝一块区域，超出任一图像的部分被裁掉
+     *
+     * @param PixelView $src 源视图（可以是自身）
+     * @param integer $dstX 目标横坐标
+     * @param integer $dstY 目标纵坐标
+     * @param integer $srcX 源横坐标
+     * @param integer $srcY 源纵坐标
+     * @param integer|null $width 宽度，null 表示到源图像右边缘
+     * @param integer|null $height 高度，null 表示到源图像下边缘
+     * @return void
+     * @throws \InvalidArgumentException 如果像素格式不同
+     */
+    public function blit(PixelView $src, int $dstX, int $dstY, int $srcX = 0, int $srcY = 0, ?int $width = null, ?int $height = null): void
+    {
+        if ($src->format !== $this->format) {
+            throw new \InvalidArgumentException("Pixel format mismatch: " . $src->format . " != " . $this->format);
+        }
+        $src->check();
+        $this->check();
+        $width ??= $src->width - $srcX;
+        $height ??= $src->height - $srcY;
+
+        // 先按源图像裁剪，再按目标图像裁剪，两边同步移动
+        [$sx, $sy, $width, $height] = $src->clip($srcX, $srcY, $width, $height);
+        $dstX += $sx - $srcX;
+        $dstY += $sy - $srcY;
+        [$dx, $dy, $width, $height] = $this->clip($dstX, $dstY, $width, $height);
+        $sx += $dx - $dstX;
+        $sy += $dy - $dstY;
+        if ($width <= 0 || $height <= 0) {
+            return;
+        }
+
+        $rowBytes = $width * $this->pixelSize;
+        $srcRow = $src->bytes + ($sy * $src->stride + $sx * $this->pixelSize);
+        $dstRow = $this->bytes + ($dy * $this->stride + $dx * $this->pixelSize);
+        if ($src->bytes == $this->bytes) {
+            // 同一块内存可能重叠，逐行经过临时字符串复制，向下移动时从最后一行开始
+            $rows = $dy > $sy ? range($height - 1, 0) : range(0, $height - 1);
+            foreach ($rows as $i) {
+                $line = \FFI::string($srcRow + $i * $src->stride, $rowBytes);
+                \FFI::memcpy($dstRow + $i * $this->stride, $line, $rowBytes);
+            }
+            return;
+        }
+        for ($i = 0; $i < $height; $i++) {
+            \FFI::memcpy($dstRow + $i * $this->stride, $srcRow + $i * $src->stride, $rowBytes);
+        }
+    }
+
+    /**
+     * 从同格式、同尺寸的视图复制全部像素
+     *
+     * @param PixelView $src 源视图
+     * @return void
+     * @throws \InvalidArgumentException 如果格式或尺寸不同
+     */
+    public function copyFrom(PixelView $src): void
+    {
+        if ($src->format !== $this->format || $src->width !== $this->width || $src->height !== $this->height) {
+            throw new \InvalidArgumentException("Pixel view format or size mismatch");
+        }
+        $src->check();
+        $this->check();
+        \FFI::memcpy($this->bytes, $src->bytes, $this->bytes());
+    }
+
+    /**
+     * 全部像素复制为字符串
+     *
+     * @return string
+     */
+    public function toString(): string
+    {
+        $this->check();
+        return \FFI::string($this->bytes, $this->bytes());
+    }
+
+    /**
+     * 用字符串覆盖全部像素
+     *
+     * @param string $data 像素数据，长度必须等于 bytes()
+     * @return void
+     * @throws \InvalidArgumentException 如果长度不符
+     */
+    public function fromString(string $data): void
+    {
+        if (strlen($data) !== $this->bytes()) {
+            throw new \InvalidArgumentException("Pixel data size mismatch: expected " . $this->bytes() . " bytes, got " . strlen($data));
+        }
+        $this->check();
+        \FFI::memcpy($this->bytes, $data, strlen($data));
+    }
+
+    /**
+     * 像素数据字节数
+     *
+     * @return integer
+     */
+    public function bytes(): int
+    {
+        return $this->stride * $this->height;
+    }
+
+    /**
+     * 按元素类型的像素指针，可以直接传给 raylib 函数
+     *
+     * @return CData
+     */
+    public function pointer(): CData
+    {
+        $this->check();
+        return $this->elements;
+    }
+
+    /**
+     * 检查坐标和通道并返回元素下标
+     *
+     * @param integer $x 横坐标
+     * @param integer $y 纵坐标
+     * @param integer $channel 通道
+     * @return integer
+     * @throws \OutOfRangeException 如果坐标或通道越界
+     */
+    private function index(int $x, int $y, int $channel): int
+    {
+        $this->check();
+        if ($x < 0 || $y < 0 || $x >= $this->width || $y >= $this->height || $channel < 0 || $channel >= $this->channels) {
+            throw new \OutOfRangeException("Pixel (" . $x . ", " . $y . ") channel " . $channel . " is out of range");
+        }
+        return ($y * $this->width + $x) * $this->channels + $channel;
+    }
+
+    /**
+     * 检查视图是否仍然有效：像素内存、尺寸和格式与创建视图时相同
+     *
+     * @return void
+     * @throws \LogicException 如果图像已被重新分配、改变尺寸或格式，或已卸载
+     */
+    private function check(): void
+    {
+        $image = $this->struct;
+        $data = $image->data;
+        if (
+            \FFI::isNull($data)
+            || $data != $this->bytes
+            || $image->width !== $this->width
+            || $image->height !== $this->height
+            || $image->format !== $this->format
+        ) {
+            throw new \LogicException("Image pixels were reallocated or unloaded since this view was created, get a new view with pixels()");
+        }
+    }
+
+    /**
+     * 检查通道数
+     *
+     * @param array<int|float> $values 各通道的值
+     * @return void
+     * @throws \InvalidArgumentException 如果通道数不符
+     */
+    private function checkValues(array $values): void
+    {
+        if (count($values) !== $this->channels) {
+            throw new \InvalidArgumentException("Expected " . $this->channels . " channel values, got " . count($values));
+        }
+    }
+
+    /**
+     * 把矩形裁剪到图像范围内
+     *
+     * @param integer $x 横坐标
+     * @param integer $y 纵坐标
+     * @param integer $width 宽度
+     * @param integer $height 高度
+     * @return array{int, int, int, int} 裁剪后的 [x, y, width, height]
+     */
+    private function clip(int $x, int $y, int $width, int $height): array
+    {
+        $x1 = max(0, $x);
+        $y1 = max(0, $y);
+        $x2 = min($this->width, $x + $width);
+        $y2 = min($this->height, $y + $height);
+        return [$x1, $y1, $x2 - $x1, $y2 - $y1];
+    }
+}
@@ -10,13 +10,16 @@ use \FFI\CData;
 
 /**
  * 矩形对象
+ * 
+ * @property float $x x坐标
+ * @property float $y y坐标
+ * @property float $width 宽度
+ * @property float $height 高度
  */
 class Rectangle extends Base
 {
-    public float $x;
-    public float $y;
-    public float $width;
-    public float $height;
+    // 常驻结构体，属性读写直接作用于它
+    private CData $data;
 
     /**
      * 矩形对象
@@ -29,24 +32,66 @@ class Rectangle extends Base
      */
     public function __construct(float $x, float $y, float $width, float $height)
     {
-        $this->x = $x;
-        $this->y = $y;
-        $this->width = $width;
-        $this->height = $height;
+        $this->data = self::ffi()->new('struct Rectangle');
+        $this->data->x = $x;
+        $this->data->y = $y;
+        $this->data->width = $width;
+        $this->data->height = $height;
     }
 
     /**
      * 矩形对象结构体
      *
+     * 返回对象自身持有的结构体，不会重新分配
+     *
      * @return CData
      */
     public function struct(): CData
     {
-        $rectangle = self::ffi()->new('struct Rectangle');
-        $rectangle->x = $this->x;
-        $rectangle->y = $this->y;
-        $rectangle->width = $this->width;
-        $rectangle->height = $this->height;
-        return $rectangle;
+        return $this->data;
+    }
+
+    /**
+     * 读取结构体字段
+     *
+     * @param string $name 字段名
+     * @return float
+     */
+    public function __get(string $name): float
+    {
+        return $this->data->$name;
+    }
+
+    /**
+     * 写入结构体字段
+     *
+     * @param string $name 字段名
+     * @param float $value 字段值
+     * @return void
+     */
+    public function __set(string $name, float $value): void
+    {
+        $this->data->$name = $value;
+    }
+
+    /**
+     * 字段是否存在
+     *
+     * @param string $name 字段名
+     * @return bool
+     */
+    public function __isset(string $name): bool
+    {
+        return in_array($name, ['x', 'y', 'width', 'height'], true);
+    }
+
+    /**
+     * 复制对象时复制结构体，避免共用同一块内存
+     *
+     * @return void
+     */
+    public function __clone(): void
+    {
+        $this->data = clone $this->data;
     }
 }
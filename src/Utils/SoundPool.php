@@ -0,0 +1,265 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use \FFI\CData;
+
+/**
+ * 声音复音池
+ *
+ * 创建时用 LoadSoundAlias() 为同一个声音预先建立固定数量的声部（共用样本数据，各自有播放位置和音量），
+ * 播放时只选择声部，不再分配。没有空闲声部时抢占优先级最低、其中最早开始的声部，
+ * 所有声部的优先级都高于新请求时放弃播放。
+ * 原声音由调用方管理，必须在 unload() 之后才能卸载。
+ */
+class SoundPool extends Base implements \Countable
+{
+    // 头文件模块
+    protected const MODULE = 'audio';
+
+    // raylib 的默认参数（声像 0.5 居中）
+    private const DEFAULTS = ['volume' => 1.0, 'pitch' => 1.0, 'pan' => 0.5];
+
+    private Sound $source;
+    private array $voices = []; // Sound 别名结构体
+    private array $priorities = [];
+    private array $started = []; // 开始播放的序号，越小越早
+    private array $settings = []; // 声部 => 当前 [volume, pitch, pan]
+    private int $tick = 0;
+    private int $steals = 0;
+    private int $rejected = 0;
+
+    /**
+     * 声音复音池
+     *
+     * @param Sound $source 原声音
+     * @param integer $voices 声部数量
+     * @return void
+     * @throws \InvalidArgumentException 如果声部数量小于 1
+     * @throws \RuntimeException 如果无法创建别名
+     */
+    public function __construct(Sound $source, int $voices = 8)
+    {
+        if ($voices < 1) {
+            throw new \InvalidArgumentException("Sound pool needs at least one voice");
+        }
+        $ffi = self::ffi();
+        $this->source = $source;
+        for ($i = 0; $i < $voices; $i++) {
+            $alias = $ffi->LoadSoundAlias($source->struct());
+            if (!$ffi->IsSoundValid($alias)) {
+                $this->unload();
+                throw new \RuntimeException("Unable to create sound alias for voice " . $i);
+            }
+            // 别名复制了原声音当前的音量等参数，先设为默认值，与缓存一致
+            $ffi->SetSoundVolume($alias, self::DEFAULTS['volume']);
+            $ffi->SetSoundPitch($alias, self::DEFAULTS['pitch']);
+            $ffi->SetSoundPan($alias, self::DEFAULTS['pan']);
+            $this->voices[$i] = $alias;
+            $this->priorities[$i] = PHP_INT_MIN;
+            $this->started[$i] = 0;
+            $this->settings[$i] = array_values(self::DEFAULTS);
+        }
+    }
+
+    /**
+     * 播放一次
+     *
+     * @param integer $priority 优先级，只能抢占优先级不高于它的声部
+     * @param float $volume 音量
+     * @param float $pitch 音高
+     * @param float $pan 声像（0.5 居中）
+     * @return integer 使用的声部，放弃播放时返回 -1
+     */
+    public function play(int $priority = 0, float $volume = 1.0, float $pitch = 1.0, float $pan = 0.5): int
+    {
+        $ffi = self::ffi();
+        $voice = $this->select($priority);
+        if ($voice < 0) {
+            $this->rejected++;
+            return -1;
+        }
+        $alias = $this->voices[$voice];
+        [$v, $p, $n] = $this->settings[$voice];
+        if ($v != $volume) {
+            $ffi->SetSoundVolume($alias, $volume);
+        }
+        if ($p != $pitch) {
+            $ffi->SetSoundPitch($alias, $pitch);
+        }
+        if ($n != $pan) {
+            $ffi->SetSoundPan($alias, $pan);
+        }
+        $this->settings[$voice] = [$volume, $pitch, $pan];
+        // PlaySound() 对正在播放的声部会从头开始
+        $ffi->PlaySound($alias);
+        $this->priorities[$voice] = $priority;
+        $this->started[$voice] = ++$this->tick;
+        return $voice;
+    }
+
+    /**
+     * 批量播放
+     *
+     * 每一项可以包含 priority、volume、pitch、pan，缺省为 play() 的默认值
+     *
+     * @param array<array{priority?: int, volume?: float, pitch?: float, pan?: float}> $shots 播放请求
+     * @return array<int> 每一项使用的声部（-1 表示放弃）
+     */
+    public function playBatch(array $shots): array
+    {
+        $voices = [];
+        foreach ($shots as $key => $shot) {
+            $voices[$key] = $this->play(
+                $shot['priority'] ?? 0,
+                (float)($shot['volume'] ?? self::DEFAULTS['volume']),
+                (float)($shot['pitch'] ?? self::DEFAULTS['pitch']),
+                (float)($shot['pan'] ?? self::DEFAULTS['pan'])
+            );
+        }
+        return $voices;
+    }
+
+    /**
+     * 停止一个声部
+     *
+     * @param integer $voice 声部
+     * @return void
+     * @throws \OutOfRangeException 如果声部不存在
+     */
+    public function stop(int $voice): void
+    {
+        if (!isset($this->voices[$voice])) {
+            throw new \OutOfRangeException("Sound pool voice " . $voice . " does not exist");
+        }
+        self::ffi()->StopSound($this->voices[$voice]);
+        $this->priorities[$voice] = PHP_INT_MIN;
+    }
+
+    /**
+     * 停止所有声部，或只停止优先级不高于 $maxPriority 的声部
+     *
+     * @param integer|null $maxPriority 最高优先级，null 表示全部
+     * @return integer 停止的声部数量
+     */
+    public function stopAll(?int $maxPriority = null): int
+    {
+        $ffi = self::ffi();
+        $stopped = 0;
+        foreach ($this->voices as $voice => $alias) {
+            if ($maxPriority !== null && $this->priorities[$voice] > $maxPriority) {
+                continue;
+            }
+            if ($ffi->IsSoundPlaying($alias)) {
+                $ffi->StopSound($alias);
+                $stopped++;
+            }
+            $this->priorities[$voice] = PHP_INT_MIN;
+        }
+        return $stopped;
+    }
+
+    /**
+     * 正在播放的声部数量
+     *
+     * @return integer
+     */
+    public function playing(): int
+    {
+        $ffi = self::ffi();
+        $playing = 0;
+        foreach ($this->voices as $alias) {
+            $playing += $ffi->IsSoundPlaying($alias) ? 1 : 0;
+        }
+        return $playing;
+    }
+
+    /**
+     * 声部数量
+     *
+     * @return integer
+     */
+    public function count(): int
+    {
+        return count($this->voices);
+    }
+
+    /**
+     * 统计：steals 抢占次数，rejected 放弃播放次数，plays 播放次数
+     *
+     * @return array{steals: int, rejected: int, plays: int}
+     */
+    public function stats(): array
+    {
+        return ['steals' => $this->steals, 'rejected' => $this->rejected, 'plays' => $this->tick];
+    }
+
+    /**
+     * 原声音
+     *
+     * @return Sound
+     */
+    public function source(): Sound
+    {
+        return $this->source;
+    }
+
+    /**
+     * 卸载所有声部（UnloadSoundAlias），不卸载原声音
+     *
+     * @return void
+     */
+    public function unload(): void
+    {
+        $ffi = self::ffi();
+        foreach ($this->voices as $alias) {
+            $ffi->UnloadSoundAlias($alias);
+        }
+        $this->voices = [];
+        $this->priorities = [];
+        $this->started = [];
+        $this->settings = [];
+    }
+
+    /**
+     * 选择声部：空闲声部中最早使用的，否则抢占优先级最低、最早开始的
+     *
+     * @param integer $priority 请求的优先级
+     * @return integer 声部，-1 表示没有可用声部
+     */
+    private function select(int $priority): int
+    {
+        $ffi = self::ffi();
+        $idle = -1;
+        $victim = -1;
+        foreach ($this->voices as $voice => $alias) {
+            if (!$ffi->IsSoundPlaying($alias)) {
+                if ($idle < 0 || $this->started[$voice] < $this->started[$idle]) {
+                    $idle = $voice;
+                }
+                continue;
+            }
+            if ($this->priorities[$voice] > $priority) {
+                continue;
+            }
+            if (
+                $victim < 0
+                || $this->priorities[$voice] < $this->priorities[$victim]
+                || ($this->priorities[$voice] === $this->priorities[$victim] && $this->started[$voice] < $this->started[$victim])
+            ) {
+                $victim = $voice;
+            }
+        }
+        if ($idle >= 0) {
+            return $idle;
+        }
+        if ($victim >= 0) {
+            $this->steals++;
+        }
+        return $victim;
+    }
+}
@@ -0,0 +1,264 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use \FFI\CData;
+
+/**
+ * 精灵批量绘制
+ *
+ * 同一图集的精灵先在 PHP 字符串中拼好顶点、纹理坐标和颜色，
+ * flush() 时用三次 UpdateMeshBuffer() 上传到一个预先分配的动态网格，再用一次 DrawMesh() 画出全部四边形，
+ * 取代逐个精灵调用 DrawTexturePro()（每次都要跨 FFI 传递四个结构体）。
+ *
+ * 坐标与 2D 绘制相同（屏幕像素，或 BeginMode2D() 中的世界坐标）。
+ * DrawMesh() 立即绘制，不经过 raylib 的内部批次：在它之前用 DrawTexture()/DrawRectangle() 等提交、
+ * 尚未刷新的图形会画在精灵之上，需要严格的前后顺序时把精灵放在同一层的最前面绘制。
+ */
+class SpriteBatch extends Base
+{
+    // 头文件模块
+    protected const MODULE = ['models', 'core'];
+
+    // 16 位索引下单个网格最多的四边形数量
+    public const MAX_CAPACITY = 16383;
+
+    // 网格缓冲区序号（顶点、纹理坐标、颜色）
+    private const BUFFER_POSITION = 0;
+    private const BUFFER_TEXCOORD = 1;
+    private const BUFFER_COLOR = 3;
+
+    private TextureAtlas $atlas;
+    private int $capacity;
+    private CData $mesh;
+    private CData $material;
+    private CData $defaultTexture; // 默认材质原来的纹理，卸载前还原
+    private CData $transform;
+    private float $texelWidth;
+    private float $texelHeight;
+    private string $vertices = '';
+    private string $texcoords = '';
+    private string $colors = '';
+    private int $count = 0;
+    private int $drawCalls = 0;
+
+    /**
+     * 精灵批量绘制
+     *
+     * 需要在 InitWindow() 之后创建（要上传网格和加载默认材质）。
+     *
+     * @param TextureAtlas $atlas 已 build() 的图集
+     * @param integer $capacity 单次绘制的四边形数量，超出时自动 flush()
+     * @return void
+     * @throws \InvalidArgumentException 如果容量超出 16 位索引范围
+     */
+    public function __construct(TextureAtlas $atlas, int $capacity = 4096)
+    {
+        if ($capacity < 1 || $capacity > self::MAX_CAPACITY) {
+            throw new \InvalidArgumentException("Sprite batch capacity must be between 1 and " . self::MAX_CAPACITY);
+        }
+        $ffi = self::ffi();
+        $texture = $atlas->texture();
+        $this->atlas = $atlas;
+        $this->capacity = $capacity;
+        $this->texelWidth = 1.0 / $texture->width;
+        $this->texelHeight = 1.0 / $texture->height;
+
+        // 网格数组由 raylib 的分配器分配，UnloadMesh() 负责释放
+        $vertexCount = $capacity * 4;
+        $mesh = $ffi->new('Mesh');
+        $mesh->vertexCount = $vertexCount;
+        $mesh->triangleCount = $capacity * 2;
+        $mesh->vertices = $ffi->cast('float *', $ffi->MemAlloc($vertexCount * 3 * 4));
+        $mesh->texcoords = $ffi->cast('float *', $ffi->MemAlloc($vertexCount * 2 * 4));
+        $mesh->colors = $ffi->cast('unsigned char *', $ffi->MemAlloc($vertexCount * 4));
+        $mesh->indices = $ffi->cast('unsigned short *', $ffi->MemAlloc($capacity * 6 * 2));
+        \FFI::memset($mesh->vertices, 0, $vertexCount * 3 * 4);
+        \FFI::memset($mesh->texcoords, 0, $vertexCount * 2 * 4);
+        \FFI::memset($mesh->colors, 0, $vertexCount * 4);
+
+        // 索引固定不变：每个四边形 (0,1,2) (0,2,3)
+        $indices = '';
+        for ($i = 0, $v = 0; $i < $capacity; $i++, $v += 4) {
+            $indices .= pack('v6', $v, $v + 1, $v + 2, $v, $v + 2, $v + 3);
+        }
+        \FFI::memcpy($mesh->indices, $indices, strlen($indices));
+        $ffi->UploadMesh(\FFI::addr($mesh), true);
+        $this->mesh = $mesh;
+
+        $this->material = $ffi->LoadMaterialDefault();
+        $this->defaultTexture = clone $this->material->maps[0]->texture;
+        $this->material->maps[0]->texture = $texture->struct();
+
+        $this->transform = $ffi->new('Matrix');
+        $this->transform->m0 = $this->transform->m5 = $this->transform->m10 = $this->transform->m15 = 1.0;
+    }
+
+    /**
+     * 绘制图集中的精灵（左上角对齐）
+     *
+     * @param string $name 图集中的名称
+     * @param float $x 左上角 X
+     * @param float $y 左上角 Y
+     * @param Color $tint 着色
+     * @param float $scale 缩放
+     * @return static
+     * @throws \InvalidArgumentException 如果名称不存在
+     */
+    public function draw(string $name, float $x, float $y, Color $tint, float $scale = 1.0): static
+    {
+        [$sx, $sy, $sw, $sh] = $this->atlas->region($name);
+        $x1 = $x + $sw * $scale;
+        $y1 = $y + $sh * $scale;
+        $this->quad($sx, $sy, $sw, $sh, $x, $y, $x, $y1, $x1, $y1, $x1, $y, $tint);
+        return $this;
+    }
+
+    /**
+     * 绘制图集中的精灵（目标矩形、原点和旋转，与 DrawTexturePro() 相同）
+     *
+     * @param string $name 图集中的名称
+     * @param Rectangle $dest 目标矩形
+     * @param Vector2 $origin 原点（相对目标矩形左上角）
+     * @param float $rotation 旋转角度（度）
+     * @param Color $tint 着色
+     * @return static
+     * @throws \InvalidArgumentException 如果名称不存在
+     */
+    public function drawPro(string $name, Rectangle $dest, Vector2 $origin, float $rotation, Color $tint): static
+    {
+        [$sx, $sy, $sw, $sh] = $this->atlas->region($name);
+        $dx = $dest->x;
+        $dy = $dest->y;
+        $dw = $dest->width;
+        $dh = $dest->height;
+        $ox = $origin->x;
+        $oy = $origin->y;
+
+        if ($rotation == 0.0) {
+            $x = $dx - $ox;
+            $y = $dy - $oy;
+            $this->quad($sx, $sy, $sw, $sh, $x, $y, $x, $y + $dh, $x + $dw, $y + $dh, $x + $dw, $y, $tint);
+            return $this;
+        }
+
+        $sin = sin(deg2rad($rotation));
+        $cos = cos(deg2rad($rotation));
+        $l = -$ox;
+        $t = -$oy;
+        $r = $dw - $ox;
+        $b = $dh - $oy;
+        $this->quad(
+            $sx, $sy, $sw, $sh,
+            $dx + $l * $cos - $t * $sin, $dy + $l * $sin + $t * $cos,
+            $dx + $l * $cos - $b * $sin, $dy + $l * $sin + $b * $cos,
+            $dx + $r * $cos - $b * $sin, $dy + $r * $sin + $b * $cos,
+            $dx + $r * $cos - $t * $sin, $dy + $r * $sin + $t * $cos,
+            $tint
+        );
+        return $this;
+    }
+
+    /**
+     * 绘制已记录的全部精灵并清空
+     *
+     * @return void
+     */
+    public function flush(): void
+    {
+        if ($this->count === 0) {
+            return;
+        }
+        $ffi = self::ffi();
+        $mesh = $this->mesh;
+        \FFI::memcpy($mesh->vertices, $this->vertices, strlen($this->vertices));
+        \FFI::memcpy($mesh->texcoords, $this->texcoords, strlen($this->texcoords));
+        \FFI::memcpy($mesh->colors, $this->colors, strlen($this->colors));
+        // 只上传用到的部分
+        $ffi->UpdateMeshBuffer($mesh, self::BUFFER_POSITION, $mesh->vertices, strlen($this->vertices), 0);
+        $ffi->UpdateMeshBuffer($mesh, self::BUFFER_TEXCOORD, $mesh->texcoords, strlen($this->texcoords), 0);
+        $ffi->UpdateMeshBuffer($mesh, self::BUFFER_COLOR, $mesh->colors, strlen($this->colors), 0);
+        $mesh->triangleCount = $this->count * 2;
+        $ffi->DrawMesh($mesh, $this->material, $this->transform);
+        $this->drawCalls++;
+
+        $this->vertices = '';
+        $this->texcoords = '';
+        $this->colors = '';
+        $this->count = 0;
+    }
+
+    /**
+     * 已记录、尚未绘制的精灵数量
+     *
+     * @return integer
+     */
+    public function count(): int
+    {
+        return $this->count;
+    }
+
+    /**
+     * 自创建以来的 DrawMesh() 调用次数
+     *
+     * @return integer
+     */
+    public function drawCalls(): int
+    {
+        return $this->drawCalls;
+    }
+
+    /**
+     * 图集
+     *
+     * @return TextureAtlas
+     */
+    public function atlas(): TextureAtlas
+    {
+        return $this->atlas;
+    }
+
+    /**
+     * 卸载网格和材质（不卸载图集纹理）
+     *
+     * @return void
+     */
+    public function unload(): void
+    {
+        $ffi = self::ffi();
+        $this->material->maps[0]->texture = $this->defaultTexture;
+        $ffi->UnloadMaterial($this->material);
+        $ffi->UnloadMesh($this->mesh);
+        $this->vertices = '';
+        $this->texcoords = '';
+        $this->colors = '';
+        $this->count = 0;
+    }
+
+    /**
+     * 记录一个四边形，顶点顺序：左上、左下、右下、右上
+     *
+     * @return void
+     */
+    private function quad(
+        int $sx, int $sy, int $sw, int $sh,
+        float $x0, float $y0, float $x1, float $y1, float $x2, float $y2, float $x3, float $y3,
+        Color $tint
+    ): void {
+        if ($this->count === $this->capacity) {
+            $this->flush();
+        }
+        $u0 = $sx * $this->texelWidth;
+        $v0 = $sy * $this->texelHeight;
+        $u1 = ($sx + $sw) * $this->texelWidth;
+        $v1 = ($sy + $sh) * $this->texelHeight;
+        $this->vertices .= pack('g12', $x0, $y0, 0.0, $x1, $y1, 0.0, $x2, $y2, 0.0, $x3, $y3, 0.0);
+        $this->texcoords .= pack('g8', $u0, $v0, $u0, $v1, $u1, $v1, $u1, $v0);
+        $this->colors .= str_repeat(pack('C4', $tint->r, $tint->g, $tint->b, $tint->a), 4);
+        $this->count++;
+    }
+}
@@ -0,0 +1,260 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use Kingbes\Raylib\Text;
+use \FFI\CData;
+use \FFI\CType;
+
+/**
+ * 文本排版缓存
+ *
+ * 文本只在第一次绘制/测量时解码并排版（码位、字形索引、每个字形的图集区域和位置），
+ * 之后每帧直接按缓存的矩形绘制图集纹理，不再重复解码 UTF-8 和查找字形。
+ * 字体、字号、字间距、行间距或文本改变时才重新排版。
+ * 适合每帧重绘的 HUD 标签。
+ */
+class TextLayout extends Base
+{
+    // 头文件模块（排版用 text，绘制用 textures 的 DrawTexturePro）
+    protected const MODULE = ['text', 'textures'];
+
+    private Font $font;
+    private string $text;
+    private float $fontSize;
+    private float $spacing;
+    private int $lineSpacing = 2; // 换行行间距，与 raylib 默认值一致
+
+    private bool $dirty = true;
+    private ?CData $glyphs = null; // struct { Rectangle source; Rectangle dest; }[n]
+    private int $count = 0; // 可见字形数量
+    private float $width = 0.0;
+    private float $height = 0.0;
+    private CData $origin; // DrawTexturePro 的原点，设为 (-x, -y) 把相对坐标的 dest 平移到绘制位置
+
+    private static CType $glyphRecord;
+
+    /**
+     * 文本排版缓存
+     *
+     * @param Font $font 字体
+     * @param string $text 文本内容
+     * @param float $fontSize 字体大小
+     * @param float $spacing 字间距
+     * @return void
+     */
+    public function __construct(Font $font, string $text, float $fontSize, float $spacing)
+    {
+        $this->font = $font;
+        $this->text = $text;
+        $this->fontSize = $fontSize;
+        $this->spacing = $spacing;
+        $this->origin = self::ffi()->new('Vector2');
+    }
+
+    /**
+     * 修改文本，内容相同时不重新排版
+     *
+     * @param string $text 文本内容
+     * @return static
+     */
+    public function setText(string $text): static
+    {
+        if ($text !== $this->text) {
+            $this->text = $text;
+            $this->dirty = true;
+        }
+        return $this;
+    }
+
+    /**
+     * 修改字体
+     *
+     * @param Font $font 字体
+     * @return static
+     */
+    public function setFont(Font $font): static
+    {
+        if ($font !== $this->font) {
+            $this->font = $font;
+            $this->dirty = true;
+        }
+        return $this;
+    }
+
+    /**
+     * 修改字体大小
+     *
+     * @param float $fontSize 字体大小
+     * @return static
+     */
+    public function setFontSize(float $fontSize): static
+    {
+        if ($fontSize !== $this->fontSize) {
+            $this->fontSize = $fontSize;
+            $this->dirty = true;
+        }
+        return $this;
+    }
+
+    /**
+     * 修改字间距
+     *
+     * @param float $spacing 字间距
+     * @return static
+     */
+    public function setSpacing(float $spacing): static
+    {
+        if ($spacing !== $this->spacing) {
+            $this->spacing = $spacing;
+            $this->dirty = true;
+        }
+        return $this;
+    }
+
+    /**
+     * 修改换行行间距
+     *
+     * @param integer $lineSpacing 行间距
+     * @return static
+     */
+    public function setLineSpacing(int $lineSpacing): static
+    {
+        if ($lineSpacing !== $this->lineSpacing) {
+            $this->lineSpacing = $lineSpacing;
+            $this->dirty = true;
+        }
+        return $this;
+    }
+
+    /**
+     * 文本内容
+     *
+     * @return string
+     */
+    public function text(): string
+    {
+        return $this->text;
+    }
+
+    /**
+     * 绘制文本，与 Text::drawTextEx() 效果一致
+     *
+     * @param Vector2 $position 位置
+     * @param Color $tint 颜色
+     * @return void
+     */
+    public function draw(Vector2 $position, Color $tint): void
+    {
+        $this->shape();
+        if ($this->count === 0) {
+            return;
+        }
+
+        // 目标矩形相对于文本左上角，旋转为 0 时 DrawTexturePro 画在 dest - origin，
+        // 移动文本只改原点，不再改写每个字形
+        $this->origin->x = -$position->x;
+        $this->origin->y = -$position->y;
+
+        $ffi = self::ffi();
+        $texture = $this->font->struct()->texture;
+        $color = $tint->cdata();
+        for ($i = 0; $i < $this->count; $i++) {
+            $glyph = $this->glyphs[$i];
+            $ffi->DrawTexturePro($texture, $glyph->source, $glyph->dest, $this->origin, 0.0, $color);
+        }
+    }
+
+    /**
+     * 文本尺寸，与 Text::measureTextEx() 效果一致
+     *
+     * @return Vector2
+     */
+    public function measure(): Vector2
+    {
+        $this->shape();
+        return new Vector2($this->width, $this->height);
+    }
+
+    /**
+     * 可见字形数量（不含空格、制表符和换行）
+     *
+     * @return integer
+     */
+    public function glyphCount(): int
+    {
+        $this->shape();
+        return $this->count;
+    }
+
+    /**
+     * 排版：解码文本，计算每个可见字形的图集区域和相对 (0, 0) 的目标矩形
+     *
+     * 与 raylib DrawTextEx/DrawTextCodepoint/MeasureTextEx 的计算方式一致。
+     *
+     * @return void
+     */
+    private function shape(): void
+    {
+        if (!$this->dirty) {
+            return;
+        }
+        $this->dirty = false;
+        $this->count = 0;
+        $this->width = 0.0;
+        $this->height = 0.0;
+        if ($this->text === '') {
+            $this->glyphs = null;
+            return;
+        }
+
+        $ffi = self::ffi();
+        $font = $this->font->struct();
+        $codepoints = Text::codepoints($this->text);
+        self::$glyphRecord ??= $ffi->type('struct { Rectangle source; Rectangle dest; }');
+        $this->glyphs = $ffi->new(\FFI::arrayType(self::$glyphRecord, [count($codepoints)]));
+
+        $scale = $this->fontSize / $font->baseSize;
+        $padding = (float)$font->glyphPadding;
+        $offsetX = 0.0;
+        $offsetY = 0.0;
+        $lineWidth = 0.0;
+        $lineGlyphs = 0;
+        $lines = 1;
+        foreach ($codepoints as $codepoint) {
+            if ($codepoint === 0x0A) {
+                $this->width = max($this->width, $lineWidth + max(0, $lineGlyphs - 1) * $this->spacing);
+                $offsetX = 0.0;
+                $offsetY += $this->fontSize + $this->lineSpacing;
+                $lineWidth = 0.0;
+                $lineGlyphs = 0;
+                $lines++;
+                continue;
+            }
+            $index = $this->font->glyphIndex($codepoint);
+            $info = $font->glyphs[$index];
+            $rec = $font->recs[$index];
+            if ($codepoint !== 0x20 && $codepoint !== 0x09) {
+                $glyph = $this->glyphs[$this->count++];
+                $glyph->source->x = $rec->x - $padding;
+                $glyph->source->y = $rec->y - $padding;
+                $glyph->source->width = $rec->width + 2 * $padding;
+                $glyph->source->height = $rec->height + 2 * $padding;
+                $glyph->dest->x = $offsetX + ($info->offsetX - $padding) * $scale;
+                $glyph->dest->y = $offsetY + ($info->offsetY - $padding) * $scale;
+                $glyph->dest->width = ($rec->width + 2 * $padding) * $scale;
+                $glyph->dest->height = ($rec->height + 2 * $padding) * $scale;
+            }
+            $advance = ($info->advanceX === 0 ? $rec->width : (float)$info->advanceX) * $scale;
+            $offsetX += $advance + $this->spacing;
+            $lineWidth += $advance;
+            $lineGlyphs++;
+        }
+        $this->width = max($this->width, $lineWidth + max(0, $lineGlyphs - 1) * $this->spacing);
+        $this->height = $this->fontSize * $lines + $this->lineSpacing * ($lines - 1);
+    }
+}
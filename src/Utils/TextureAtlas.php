@@ -0,0 +1,202 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use Kingbes\Raylib\Textures;
+
+/**
+ * 纹理图集
+ *
+ * 把多张小图按行（shelf）打包进一张纹理，记录每张图在图集中的矩形。
+ * 同一图集的精灵都用 SpriteBatch 绘制，整批只需要一次纹理绑定。
+ */
+class TextureAtlas extends Base
+{
+    private array $images = []; // 名称 => Image
+    private array $rects = []; // 名称 => [x, y, width, height]
+    private ?Texture $texture = null;
+    private ?Image $image = null;
+
+    /**
+     * 添加一张图，build() 之前有效
+     *
+     * @param string $name 名称
+     * @param Image $image 图像（build() 时复制像素，之后可以卸载）
+     * @return static
+     * @throws \LogicException 如果图集已生成
+     */
+    public function add(string $name, Image $image): static
+    {
+        if ($this->texture !== null) {
+            throw new \LogicException("Texture atlas is already built");
+        }
+        $this->images[$name] = $image;
+        return $this;
+    }
+
+    /**
+     * 打包全部图像并上传为纹理
+     *
+     * 按高度从大到小逐行摆放，行宽取能容纳全部面积的 2 的幂次，图与图之间留 padding 像素空白防止采样串色。
+     *
+     * @param integer $padding 间距（像素）
+     * @param integer $maxSize 图集最大边长
+     * @return Texture 图集纹理
+     * @throws \RuntimeException 如果超出最大边长
+     */
+    public function build(int $padding = 1, int $maxSize = 4096): Texture
+    {
+        if ($this->texture !== null) {
+            return $this->texture;
+        }
+
+        $area = 0;
+        $widest = 1;
+        foreach ($this->images as $image) {
+            $area += ($image->width + $padding) * ($image->height + $padding);
+            $widest = max($widest, $image->width + 2 * $padding);
+        }
+        $width = 1;
+        while ($width < $widest || $width * $width < $area) {
+            $width *= 2;
+        }
+        $width = min($width, $maxSize);
+
+        $names = array_keys($this->images);
+        usort($names, fn($a, $b) => $this->images[$b]->height <=> $this->images[$a]->height);
+
+        $x = $padding;
+        $y = $padding;
+        $rowHeight = 0;
+        foreach ($names as $name) {
+            $image = $this->images[$name];
+            if ($x + $image->width + $padding > $width) {
+                $x = $padding;
+                $y += $rowHeight + $padding;
+                $rowHeight = 0;
+            }
+            if ($x + $image->width + $padding > $width) {
+                throw new \RuntimeException("Image '" . $name . "' is wider than the atlas limit " . $maxSize);
+            }
+            $this->rects[$name] = [$x, $y, $image->width, $image->height];
+            $x += $image->width + $padding;
+            $rowHeight = max($rowHeight, $image->height);
+        }
+        $height = $y + $rowHeight + $padding;
+        if ($height > $maxSize) {
+            throw new \RuntimeException("Images do not fit into a " . $maxSize . "x" . $maxSize . " atlas");
+        }
+
+        $this->image = Textures::genImageColor($width, $height, new Color(0, 0, 0, 0));
+        $white = new Color(255, 255, 255, 255);
+        foreach ($this->rects as $name => [$rx, $ry, $rw, $rh]) {
+            Textures::imageDraw(
+                $this->image,
+                $this->images[$name],
+                new Rectangle(0, 0, $rw, $rh),
+                new Rectangle($rx, $ry, $rw, $rh),
+                $white
+            );
+        }
+        $this->images = [];
+        $this->texture = Textures::loadTextureFromImage($this->image);
+        return $this->texture;
+    }
+
+    /**
+     * 图像在图集中的矩形
+     *
+     * @param string $name 名称
+     * @return Rectangle
+     * @throws \InvalidArgumentException 如果名称不存在
+     */
+    public function rect(string $name): Rectangle
+    {
+        [$x, $y, $width, $height] = $this->region($name);
+        return new Rectangle($x, $y, $width, $height);
+    }
+
+    /**
+     * 图像在图集中的矩形 [x, y, width, height]
+     *
+     * @param string $name 名称
+     * @return array{int, int, int, int}
+     * @throws \InvalidArgumentException 如果名称不存在
+     */
+    public function region(string $name): array
+    {
+        if (!isset($this->rects[$name])) {
+            throw new \InvalidArgumentException("Unknown atlas region: " . $name);
+        }
+        return $this->rects[$name];
+    }
+
+    /**
+     * 是否包含指定名称
+     *
+     * @param string $name 名称
+     * @return boolean
+     */
+    public function has(string $name): bool
+    {
+        return isset($this->rects[$name]) || isset($this->images[$name]);
+    }
+
+    /**
+     * 全部名称 => [x, y, width, height]
+     *
+     * @return array<string, array{int, int, int, int}>
+     */
+    public function regions(): array
+    {
+        return $this->rects;
+    }
+
+    /**
+     * 图集纹理
+     *
+     * @return Texture
+     * @throws \LogicException 如果尚未 build()
+     */
+    public function texture(): Texture
+    {
+        if ($this->texture === null) {
+            throw new \LogicException("Texture atlas is not built yet");
+        }
+        return $this->texture;
+    }
+
+    /**
+     * 图集图像（CPU 内存中的副本，可以导出检查）
+     *
+     * @return Image
+     * @throws \LogicException 如果尚未 build()
+     */
+    public function image(): Image
+    {
+        if ($this->image === null) {
+            throw new \LogicException("Texture atlas is not built yet");
+        }
+        return $this->image;
+    }
+
+    /**
+     * 卸载图集纹理和图像
+     *
+     * @return void
+     */
+    public function unload(): void
+    {
+        if ($this->texture !== null) {
+            Textures::unloadTexture($this->texture);
+            Textures::unloadImage($this->image);
+        }
+        $this->texture = null;
+        $this->image = null;
+        $this->rects = [];
+    }
+}
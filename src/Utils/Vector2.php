@@ -16,8 +16,8 @@ use \FFI\CData;
  */
 class Vector2 extends Base
 {
-    public float $x;
-    public float $y;
+    // 常驻结构体，属性读写直接作用于它
+    private CData $data;
 
     /**
      * 向量2对象
@@ -28,20 +28,64 @@ class Vector2 extends Base
      */
     public function __construct(float $x, float $y)
     {
-        $this->x = $x;
-        $this->y = $y;
+        $this->data = self::ffi()->new('struct Vector2');
+        $this->data->x = $x;
+        $this->data->y = $y;
     }
 
     /**
      * 向量2对象结构体
      *
+     * 返回对象自身持有的结构体，不会重新分配
+     *
      * @return CData
      */
     public function struct(): CData
     {
-        $vector2 = self::ffi()->new('struct Vector2');
-        $vector2->x = $this->x;
-        $vector2->y = $this->y;
-        return $vector2;
+        return $this->data;
+    }
+
+    /**
+     * 读取结构体字段
+     *
+     * @param string $name 字段名
+     * @return float
+     */
+    public function __get(string $name): float
+    {
+        return $this->data->$name;
+    }
+
+    /**
+     * 写入结构体字段
+     *
+     * @param string $name 字段名
+     * @param float $value 字段值
+     * @return void
+     */
+    public function __set(string $name, float $value): void
+    {
+        $this->data->$name = $value;
+    }
+
+    /**
+     * 字段是否存在
+     *
+     * @param string $name 字段名
+     * @return bool
+     */
+    public function __isset(string $name): bool
+    {
+        return in_array($name, ['x', 'y'], true);
+    }
+
+    /**
+     * 复制对象时复制结构体，避免共用同一块内存
+     *
+     * @return void
+     */
+    public function __clone(): void
+    {
+        $this->data = clone $this->data;
     }
 }
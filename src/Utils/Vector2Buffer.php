@@ -0,0 +1,156 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use \FFI\CData;
+
+/**
+ * 向量2缓冲区
+ * 
+ * 可增长的 Vector2 C 数组，点集类绘制函数直接使用，
+ * 每帧重绘时不需要重新构建数组。
+ */
+class Vector2Buffer extends Base implements \Countable
+{
+    private CData $data; // Vector2[capacity]
+    private int $capacity;
+    private int $count = 0;
+
+    /**
+     * 向量2缓冲区
+     *
+     * @param integer $capacity 初始容量
+     * @return void
+     */
+    public function __construct(int $capacity = 64)
+    {
+        $this->allocate(max(1, $capacity));
+    }
+
+    /**
+     * 从 Vector2 数组创建
+     *
+     * @param Vector2[] $points 点集
+     * @return static
+     */
+    public static function fromArray(array $points): static
+    {
+        $buffer = new static(count($points));
+        foreach ($points as $point) {
+            $buffer->append($point->x, $point->y);
+        }
+        return $buffer;
+    }
+
+    /**
+     * 追加一个点
+     *
+     * @param float $x x轴
+     * @param float $y y轴
+     * @return integer 新点的索引
+     */
+    public function append(float $x, float $y): int
+    {
+        if ($this->count === $this->capacity) {
+            $this->allocate($this->capacity * 2);
+        }
+        $point = $this->data[$this->count];
+        $point->x = $x;
+        $point->y = $y;
+        return $this->count++;
+    }
+
+    /**
+     * 修改一个点
+     *
+     * @param integer $index 索引
+     * @param float $x x轴
+     * @param float $y y轴
+     * @return void
+     * @throws \OutOfRangeException 如果索引越界
+     */
+    public function set(int $index, float $x, float $y): void
+    {
+        if ($index < 0 || $index >= $this->count) {
+            throw new \OutOfRangeException("Point index out of range: " . $index);
+        }
+        $point = $this->data[$index];
+        $point->x = $x;
+        $point->y = $y;
+    }
+
+    /**
+     * 读取一个点
+     *
+     * @param integer $index 索引
+     * @return Vector2
+     * @throws \OutOfRangeException 如果索引越界
+     */
+    public function get(int $index): Vector2
+    {
+        if ($index < 0 || $index >= $this->count) {
+            throw new \OutOfRangeException("Point index out of range: " . $index);
+        }
+        return new Vector2($this->data[$index]->x, $this->data[$index]->y);
+    }
+
+    /**
+     * 清空点集，保留已分配的内存
+     *
+     * @return void
+     */
+    public function clear(): void
+    {
+        $this->count = 0;
+    }
+
+    /**
+     * 点的数量
+     *
+     * @return integer
+     */
+    public function count(): int
+    {
+        return $this->count;
+    }
+
+    /**
+     * 已分配的点数量
+     *
+     * @return integer
+     */
+    public function capacity(): int
+    {
+        return $this->capacity;
+    }
+
+    /**
+     * 点集数组，可直接传给 Vector2* 参数
+     *
+     * @return CData Vector2[capacity]
+     */
+    public function struct(): CData
+    {
+        return $this->data;
+    }
+
+    /**
+     * 重新分配数组并复制已有的点
+     *
+     * @param integer $capacity 容量
+     * @return void
+     */
+    private function allocate(int $capacity): void
+    {
+        $data = self::ffi()->new('Vector2[' . $capacity . ']');
+        if ($this->count > 0) {
+            \FFI::memcpy($data, $this->data, $this->count * \FFI::sizeof($data[0]));
+        }
+        $this->data = $data;
+        $this->capacity = $capacity;
+    }
+}
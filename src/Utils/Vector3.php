@@ -17,9 +17,8 @@ use \FFI\CData;
  */
 class Vector3 extends Base
 {
-    public float $x;
-    public float $y;
-    public float $z;
+    // 常驻结构体，属性读写直接作用于它
+    private CData $data;
 
     /**
      * 向量3对象
@@ -31,22 +30,65 @@ class Vector3 extends Base
      */
     public function __construct(float $x, float $y, float $z)
     {
-        $this->x = $x;
-        $this->y = $y;
-        $this->z = $z;
+        $this->data = self::ffi()->new('struct Vector3');
+        $this->data->x = $x;
+        $this->data->y = $y;
+        $this->data->z = $z;
     }
 
     /**
      * 向量3对象结构体
      *
+     * 返回对象自身持有的结构体，不会重新分配
+     *
      * @return CData
      */
     public function struct(): CData
     {
-        $vector3 = self::ffi()->new('struct Vector3');
-        $vector3->x = $this->x;
-        $vector3->y = $this->y;
-        $vector3->z = $this->z;
-        return $vector3;
+        return $this->data;
+    }
+
+    /**
+     * 读取结构体字段
+     *
+     * @param string $name 字段名
+     * @return float
+     */
+    public function __get(string $name): float
+    {
+        return $this->data->$name;
+    }
+
+    /**
+     * 写入结构体字段
+     *
+     * @param string $name 字段名
+     * @param float $value 字段值
+     * @return void
+     */
+    public function __set(string $name, float $value): void
+    {
+        $this->data->$name = $value;
+    }
+
+    /**
+     * 字段是否存在
+     *
+     * @param string $name 字段名
+     * @return bool
+     */
+    public function __isset(string $name): bool
+    {
+        return in_array($name, ['x', 'y', 'z'], true);
+    }
+
+    /**
+     * 复制对象时复制结构体，避免共用同一块内存
+     *
+     * @return void
+     */
+    public function __clone(): void
+    {
+        $this->data = clone $this->data;
     }
 }
@@ -12,14 +12,14 @@ use \FFI\CData;
  * 波，音频波数据
  * 
  * @property int $frameCount （包括通道在内的）总帧数
- * @property int $sampleCount 频率（每秒采样次数）
+ * @property int $sampleRate 频率（每秒采样次数）
  * @property int $sampleSize 样本大小（每个样本的位数）：8、16、32（不支持 24）
  * @property int $channels 声道数量（1 - 单声道，2 - 立体声，...）
  */
 class Wave extends Base
 {
     public readonly int $frameCount;
-    public readonly int $sampleCount;
+    public readonly int $sampleRate;
     public readonly int $sampleSize;
     public readonly int $channels;
     private CData $data;
@@ -27,7 +27,7 @@ class Wave extends Base
     public function __construct(CData $cdata)
     {
         $this->frameCount = $cdata->frameCount;
-        $this->sampleCount = $cdata->sampleCount;
+        $this->sampleRate = $cdata->sampleRate;
         $this->sampleSize = $cdata->sampleSize;
         $this->channels = $cdata->channels;
         $this->data = $cdata;
@@ -0,0 +1,336 @@
+<?php
+
+// 严格模式
+declare(strict_types=1);
+
+namespace Kingbes\Raylib\Utils;
+
+use Kingbes\Raylib\Base;
+use \FFI\CData;
+
+/**
+ * 波形样本视图
+ *
+ * 直接指向 LoadWaveSamples() 返回的 32 位浮点数组（交错排列），不复制成 PHP 数组。
+ * 批量操作（gain、mix、peak、rms）按固定大小的块 unpack/pack，内存占用与 PCM 数据成正比。
+ *
+ * 所有权：Audio::loadWaveSamples() 返回的视图拥有内存，用 Audio::unloadWaveSamples() 或 unload() 释放；
+ * slice() 返回的视图与原视图共用内存，不能单独释放，原视图释放后不能再使用。
+ */
+class WaveSamples extends Base implements \Countable
+{
+    // 头文件模块
+    protected const MODULE = 'audio';
+
+    // 批量操作每块的样本数
+    private const CHUNK = 65536;
+
+    public readonly int $channels;
+    public readonly int $sampleRate;
+    private ?CData $data; // float *
+    private int $count; // 样本数（帧数 × 声道数）
+    private ?WaveSamples $owner; // 切片所属的视图，null 表示自己拥有内存
+
+    /**
+     * 波形样本视图
+     *
+     * @param CData $data float 指针
+     * @param integer $frames 帧数
+     * @param integer $channels 声道数
+     * @param integer $sampleRate 采样率
+     * @param WaveSamples|null $owner 内存所属的视图（切片）
+     * @return void
+     */
+    public function __construct(CData $data, int $frames, int $channels, int $sampleRate, ?WaveSamples $owner = null)
+    {
+        $this->data = $data;
+        $this->count = $frames * $channels;
+        $this->channels = $channels;
+        $this->sampleRate = $sampleRate;
+        $this->owner = $owner;
+    }
+
+    /**
+     * 样本数（帧数 × 声道数）
+     *
+     * @return integer
+     */
+    public function count(): int
+    {
+        return $this->count;
+    }
+
+    /**
+     * 帧数
+     *
+     * @return integer
+     */
+    public function frames(): int
+    {
+        return intdiv($this->count, $this->channels);
+    }
+
+    /**
+     * 时长（秒）
+     *
+     * @return float
+     */
+    public function duration(): float
+    {
+        return $this->sampleRate > 0 ? $this->frames() / $this->sampleRate : 0.0;
+    }
+
+    /**
+     * 读取样本
+     *
+     * @param integer $frame 帧
+     * @param integer $channel 声道
+     * @return float
+     * @throws \OutOfRangeException 如果越界
+     */
+    public function get(int $frame, int $channel = 0): float
+    {
+        return $this->pointer()[$this->index($frame, $channel)];
+    }
+
+    /**
+     * 写入样本
+     *
+     * @param integer $frame 帧
+     * @param integer $channel 声道
+     * @param float $value 样本值
+     * @return void
+     * @throws \OutOfRangeException 如果越界
+     */
+    public function set(int $frame, int $channel, float $value): void
+    {
+        $this->pointer()[$this->index($frame, $channel)] = $value;
+    }
+
+    /**
+     * 切片（不复制，与当前视图共用内存）
+     *
+     * @param integer $frame 起始帧
+     * @param integer|null $frames 帧数，null 表示到末尾
+     * @return WaveSamples
+     * @throws \OutOfRangeException 如果越界
+     */
+    public function slice(int $frame, ?int $frames = null): WaveSamples
+    {
+        $total = $this->frames();
+        $frames ??= $total - $frame;
+        if ($frame < 0 || $frames < 0 || $frame + $frames > $total) {
+            throw new \OutOfRangeException("Slice [" . $frame . ", " . ($frame + $frames) . ") is out of range 0.." . $total);
+        }
+        return new WaveSamples($this->pointer() + $frame * $this->channels, $frames, $this->channels, $this->sampleRate, $this->owner ?? $this);
+    }
+
+    /**
+     * 乘以增益（原地修改）
+     *
+     * @param float $gain 线性增益
+     * @return static
+     */
+    public function gain(float $gain): static
+    {
+        $this->map(static function (array $samples) use ($gain): array {
+            foreach ($samples as $i => $sample) {
+                $samples[$i] = $sample * $gain;
+            }
+            return $samples;
+        });
+        return $this;
+    }
+
+    /**
+     * 把另一段样本乘以增益后加到当前样本上（原地修改），超出当前长度的部分被忽略
+     *
+     * @param WaveSamples $other 另一段样本，声道数需相同
+     * @param float $gain 另一段样本的增益
+     * @param integer $frame 从当前样本的第几帧开始混合
+     * @return static
+     * @throws \InvalidArgumentException 如果声道数不同
+     * @throws \OutOfRangeException 如果起始帧越界
+     */
+    public function mix(WaveSamples $other, float $gain = 1.0, int $frame = 0): static
+    {
+        if ($other->channels !== $this->channels) {
+            throw new \InvalidArgumentException("Cannot mix " . $other->channels . " channel samples into " . $this->channels . " channels");
+        }
+        if ($frame < 0 || $frame > $this->frames()) {
+            throw new \OutOfRangeException("Mix offset " . $frame . " is out of range 0.." . $this->frames());
+        }
+        $count = min($other->count, $this->count - $frame * $this->channels);
+        $dst = $this->pointer() + $frame * $this->channels;
+        $src = $other->pointer();
+        for ($offset = 0; $offset < $count; $offset += self::CHUNK) {
+            $n = min(self::CHUNK, $count - $offset);
+            $a = unpack('g*', \FFI::string($dst + $offset, $n * 4));
+            $b = unpack('g*', \FFI::string($src + $offset, $n * 4));
+            foreach ($a as $i => $sample) {
+                $a[$i] = $sample + $b[$i] * $gain;
+            }
+            \FFI::memcpy($dst + $offset, pack('g*', ...$a), $n * 4);
+        }
+        return $this;
+    }
+
+    /**
+     * 峰值（绝对值最大的样本）
+     *
+     * @param integer|null $channel 声道，null 表示所有声道
+     * @return float
+     */
+    public function peak(?int $channel = null): float
+    {
+        $peak = 0.0;
+        $this->scan(function (array $samples, int $first) use (&$peak, $channel): void {
+            foreach ($samples as $i => $sample) {
+                if ($channel === null || ($first + $i - 1) % $this->channels === $channel) {
+                    $peak = max($peak, abs($sample));
+                }
+            }
+        });
+        return $peak;
+    }
+
+    /**
+     * 均方根电平
+     *
+     * @param integer|null $channel 声道，null 表示所有声道
+     * @return float
+     */
+    public function rms(?int $channel = null): float
+    {
+        $sum = 0.0;
+        $n = 0;
+        $this->scan(function (array $samples, int $first) use (&$sum, &$n, $channel): void {
+            foreach ($samples as $i => $sample) {
+                if ($channel === null || ($first + $i - 1) % $this->channels === $channel) {
+                    $sum += $sample * $sample;
+                    $n++;
+                }
+            }
+        });
+        return $n > 0 ? sqrt($sum / $n) : 0.0;
+    }
+
+    /**
+     * 复制为 PHP 数组（小片段调试用，大片段请用批量操作）
+     *
+     * @return array<float>
+     */
+    public function toArray(): array
+    {
+        return $this->count > 0 ? array_values(unpack('g*', $this->toString())) : [];
+    }
+
+    /**
+     * 复制为二进制字符串（32 位浮点交错 PCM，可直接写入 AudioRingBuffer）
+     *
+     * @return string
+     */
+    public function toString(): string
+    {
+        return $this->count > 0 ? \FFI::string($this->pointer(), $this->count * 4) : '';
+    }
+
+    /**
+     * float 指针
+     *
+     * @return CData
+     * @throws \LogicException 如果内存已释放
+     */
+    public function pointer(): CData
+    {
+        if ($this->data === null || ($this->owner !== null && !$this->owner->isLoaded())) {
+            throw new \LogicException("Wave samples have been unloaded");
+        }
+        return $this->data;
+    }
+
+    /**
+     * 内存是否仍然有效
+     *
+     * @return boolean
+     */
+    public function isLoaded(): bool
+    {
+        return $this->data !== null && ($this->owner === null || $this->owner->isLoaded());
+    }
+
+    /**
+     * 是否拥有内存（不是切片）
+     *
+     * @return boolean
+     */
+    public function isOwner(): bool
+    {
+        return $this->owner === null;
+    }
+
+    /**
+     * 释放内存（UnloadWaveSamples），切片不能释放
+     *
+     * @return void
+     * @throws \LogicException 如果是切片
+     */
+    public function unload(): void
+    {
+        if ($this->owner !== null) {
+            throw new \LogicException("Cannot unload a slice of wave samples, unload the original view");
+        }
+        if ($this->data !== null) {
+            self::ffi()->UnloadWaveSamples($this->data);
+            $this->data = null;
+        }
+    }
+
+    /**
+     * 按块读取、修改并写回
+     *
+     * @param \Closure $callback 参数为样本数组（键从 1 开始），返回修改后的数组
+     * @return void
+     */
+    private function map(\Closure $callback): void
+    {
+        $data = $this->pointer();
+        for ($offset = 0; $offset < $this->count; $offset += self::CHUNK) {
+            $n = min(self::CHUNK, $this->count - $offset);
+            $samples = $callback(unpack('g*', \FFI::string($data + $offset, $n * 4)));
+            \FFI::memcpy($data + $offset, pack('g*', ...$samples), $n * 4);
+        }
+    }
+
+    /**
+     * 按块读取
+     *
+     * @param \Closure $callback 参数为样本数组（键从 1 开始）和块起始样本序号
+     * @return void
+     */
+    private function scan(\Closure $callback): void
+    {
+        $data = $this->pointer();
+        for ($offset = 0; $offset < $this->count; $offset += self::CHUNK) {
+            $n = min(self::CHUNK, $this->count - $offset);
+            $callback(unpack('g*', \FFI::string($data + $offset, $n * 4)), $offset);
+        }
+    }
+
+    /**
+     * 样本序号
+     *
+     * @param integer $frame 帧
+     * @param integer $channel 声道
+     * @return integer
+     * @throws \OutOfRangeException 如果越界
+     */
+    private function index(int $frame, int $channel): int
+    {
+        $index = $frame * $this->channels + $channel;
+        if ($frame < 0 || $channel < 0 || $channel >= $this->channels || $index >= $this->count) {
+            throw new \OutOfRangeException("Sample (" . $frame . ", " . $channel . ") is out of range");
+        }
+        return $index;
+    }
+}
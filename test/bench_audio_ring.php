@@ -0,0 +1,128 @@
+<?php
+
+/**
+ * 音频流提交对比：Audio::updateAudioStream() 旧写法（每次 new char[n] + memcpy）与 AudioRingBuffer
+ *
+ * 1. 单次写入开销：不需要音频设备
+ * 2. 48kHz 立体声 32 位浮点持续播放：每秒约 100 次写入（生成器节奏），统计欠载、延迟和内存增长
+ *
+ * php test/bench_audio_ring.php [播放秒数] [周期帧数]
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\Audio;
+use Kingbes\Raylib\Utils\AudioRingBuffer;
+use Kingbes\Raylib\Utils\AudioStream;
+
+$seconds = (float)($argv[1] ?? 10);
+$periodFrames = (int)($argv[2] ?? 1024);
+$sampleRate = 48000;
+$channels = 2;
+$chunkFrames = intdiv($sampleRate, 100); // 每次写入 10ms
+$ffi = Audio::ffi();
+
+// 正弦波，每块相位连续
+$phase = 0.0;
+$step = 2 * M_PI * 440 / $sampleRate;
+$chunk = function () use (&$phase, $step, $chunkFrames): string {
+    $samples = [];
+    for ($i = 0; $i < $chunkFrames; $i++) {
+        $v = 0.2 * sin($phase);
+        $samples[] = $v;
+        $samples[] = $v;
+        $phase += $step;
+    }
+    return pack('g*', ...$samples);
+};
+$data = $chunk();
+
+// 1. 单次写入开销
+$iterations = 20000;
+$t = hrtime(true);
+for ($i = 0; $i < $iterations; $i++) {
+    $c_char = $ffi->new('char[' . strlen($data) . ']');
+    \FFI::memcpy($c_char, $data, strlen($data));
+}
+$old = (hrtime(true) - $t) / $iterations;
+
+$stream = $ffi->new('AudioStream');
+$stream->sampleRate = $sampleRate;
+$stream->sampleSize = 32;
+$stream->channels = $channels;
+$ring = new AudioRingBuffer(new AudioStream($stream), $periodFrames, $periodFrames * 8);
+$t = hrtime(true);
+for ($i = 0; $i < $iterations; $i++) {
+    $ring->write($data);
+    $ring->clear();
+}
+$new = (hrtime(true) - $t) / $iterations;
+
+printf("write %d frames (%d bytes)\n", $chunkFrames, strlen($data));
+printf("  new char[n] + memcpy  %8.2f us/write\n", $old / 1e3);
+printf("  AudioRingBuffer       %8.2f us/write  (%.1fx)\n", $new / 1e3, $old / $new);
+
+// 2. 持续播放
+Audio::initAudioDevice();
+if (!Audio::isAudioDeviceReady()) {
+    echo "audio device not available, skipping playback test\n";
+    exit(0);
+}
+$ring = Audio::loadAudioRingBuffer($sampleRate, 32, $channels, $periodFrames, 8);
+// 预先填充两个周期
+while ($ring->bufferedFrames() < 2 * $periodFrames) {
+    $ring->write($chunk());
+}
+Audio::playAudioStream($ring->stream());
+
+// 延迟直方图（0.5ms 一格），预先分配，不影响内存增长统计
+$histogram = array_fill(0, 2000, 0);
+$samples = 0;
+$writes = 0;
+$writeTime = 0;
+$memory = memory_get_usage();
+$start = hrtime(true);
+$next = $start;
+while (($now = hrtime(true)) - $start < $seconds * 1e9) {
+    // 按实时节奏生成：每 10ms 一块
+    if ($now >= $next) {
+        $block = $chunk();
+        $t = hrtime(true);
+        $ring->write($block);
+        $writeTime += hrtime(true) - $t;
+        $writes++;
+        $next += 10_000_000;
+    }
+    $ring->pump();
+    $histogram[min(1999, (int)($ring->latency() * 2000))]++;
+    $samples++;
+    usleep(1000);
+}
+$stats = $ring->stats();
+$growth = memory_get_usage() - $memory;
+Audio::stopAudioStream($ring->stream());
+Audio::unloadAudioRingBuffer($ring);
+Audio::closeAudioDevice();
+
+$percentile = function (float $p) use ($histogram, $samples): float {
+    $target = $p * $samples;
+    $sum = 0;
+    foreach ($histogram as $bucket => $count) {
+        $sum += $count;
+        if ($sum >= $target) {
+            return $bucket / 2;
+        }
+    }
+    return 1000.0;
+};
+printf("\nsustained %.0fs at %d Hz stereo float, period %d frames\n", $seconds, $sampleRate, $periodFrames);
+printf("  writes           %d (%.1f/s, %.2f us each)\n", $writes, $writes / $seconds, $writeTime / max(1, $writes) / 1e3);
+printf("  underruns        %d (%d frames)\n", $stats['underruns'], $stats['underrunFrames']);
+printf("  dropped frames   %d\n", $stats['droppedFrames']);
+printf("  latency          median %.1f ms, p99 %.1f ms, max %.1f ms (capacity %.1f ms)\n",
+    $percentile(0.5),
+    $percentile(0.99),
+    $percentile(1.0),
+    $stats['maxLatency'] * 1e3
+);
+printf("  memory growth    %d bytes\n", $growth);
@@ -0,0 +1,84 @@
+<?php
+
+/**
+ * 批量矩形绘制对比：tetris.php 式逐个 Shapes::drawRectangle() 与 Shapes::drawRectanglesBatch()
+ * （二进制字符串和 unsigned char * 原生指针两种缓冲区）
+ *
+ * php test/bench_draw_rectangles.php [矩形数量] [帧数]
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\Core;
+use Kingbes\Raylib\Shapes;
+use Kingbes\Raylib\Utils;
+
+$count = (int)($argv[1] ?? 2000);
+$frames = (int)($argv[2] ?? 120);
+
+const BLOCK_SIZE = 12;
+const GRID_WIDTH = 60;
+
+Core::initWindow(GRID_WIDTH * BLOCK_SIZE, 600, "bench - drawRectanglesBatch");
+
+$colors = [
+    Utils::color(0, 255, 255, 255),
+    Utils::color(255, 255, 0, 255),
+    Utils::color(128, 0, 128, 255),
+    Utils::color(255, 165, 0, 255),
+    Utils::color(0, 0, 255, 255),
+    Utils::color(0, 255, 0, 255),
+    Utils::color(255, 0, 0, 255),
+];
+$black = Utils::color(0, 0, 0);
+
+// 与 tetris.php 相同的网格方块
+$blocks = [];
+$buffer = '';
+for ($i = 0; $i < $count; $i++) {
+    $x = ($i % GRID_WIDTH) * BLOCK_SIZE;
+    $y = intdiv($i, GRID_WIDTH) % 50 * BLOCK_SIZE;
+    $color = $colors[$i % count($colors)];
+    $blocks[] = [$x, $y, $color];
+    $buffer .= Shapes::packRectangle($x, $y, BLOCK_SIZE - 1, BLOCK_SIZE - 1, $color);
+}
+
+// 同样的记录放在原生内存中，按 unsigned char * 传入（需要给出数量）
+$native = Shapes::ffi()->new('unsigned char[' . strlen($buffer) . ']');
+\FFI::memcpy($native, $buffer, strlen($buffer));
+$pointer = Shapes::ffi()->cast('unsigned char *', $native);
+
+$modes = [
+    'drawRectangle' => function () use ($blocks) {
+        foreach ($blocks as [$x, $y, $color]) {
+            Shapes::drawRectangle($x, $y, BLOCK_SIZE - 1, BLOCK_SIZE - 1, $color);
+        }
+    },
+    'drawRectanglesBatch' => function () use ($buffer) {
+        Shapes::drawRectanglesBatch($buffer);
+    },
+    'batch (uchar *)' => function () use ($pointer, $count) {
+        Shapes::drawRectanglesBatch($pointer, $count);
+    },
+];
+
+foreach ($modes as $name => $draw) {
+    $elapsed = 0;
+    $rendered = 0;
+    for ($f = 0; $f < $frames && !Core::windowShouldClose(); $f++) {
+        Core::beginDrawing();
+        Core::clearBackground($black);
+        $t = hrtime(true);
+        $draw();
+        $elapsed += hrtime(true) - $t;
+        Core::endDrawing();
+        $rendered++;
+    }
+    if ($rendered === 0) {
+        printf("%-20s window closed, no frames rendered\n", $name);
+        continue;
+    }
+    printf("%-20s %6d rects: %8.3f ms/frame (%d frames)\n", $name, $count, $elapsed / $rendered / 1e6, $rendered);
+}
+
+Core::closeWindow();
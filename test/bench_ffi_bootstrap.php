@@ -0,0 +1,43 @@
+<?php
+
+/**
+ * FFI 启动耗时对比：FFI::cdef() 与 opcache.preload + FFI::scope()
+ *
+ * php test/bench_ffi_bootstrap.php [次数]
+ *
+ * 注意：CLI 下每个进程都会执行一次预加载，进程总耗时仍包含解析；
+ * Base::ffi() 耗时即 php-fpm 等常驻服务中每个请求的实际开销。
+ */
+
+$runs = (int)($argv[1] ?? 20);
+$root = dirname(__DIR__);
+$code = 'require "' . $root . '/vendor/autoload.php";'
+    . '$t = hrtime(true);'
+    . '\Kingbes\Raylib\Base::ffi();'
+    . 'echo (hrtime(true) - $t) / 1e6;';
+
+$modes = [
+    'cdef' => '-d opcache.enable_cli=0',
+    'preload' => '-d opcache.enable_cli=1 -d ffi.enable=preload'
+        . ' -d opcache.preload=' . escapeshellarg($root . '/preload.php')
+        . ' -d opcache.preload_user=' . escapeshellarg(get_current_user()),
+];
+
+foreach ($modes as $name => $ini) {
+    $ffi = [];
+    $wall = [];
+    for ($i = 0; $i < $runs; $i++) {
+        $t = hrtime(true);
+        $out = shell_exec(PHP_BINARY . ' ' . $ini . ' -r ' . escapeshellarg($code));
+        $wall[] = (hrtime(true) - $t) / 1e6;
+        $ffi[] = (float)$out;
+    }
+    sort($ffi);
+    sort($wall);
+    printf(
+        "%-8s Base::ffi() median %8.3f ms | process median %8.3f ms\n",
+        $name,
+        $ffi[intdiv($runs, 2)],
+        $wall[intdiv($runs, 2)]
+    );
+}
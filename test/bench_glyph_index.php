@@ -0,0 +1,62 @@
+<?php
+
+/**
+ * 字形索引查找对比：raylib GetGlyphIndex() 线性查找与 Font::glyphIndex() 查找表
+ *
+ * 用合成的字体结构体（只填充 glyphs），不需要窗口和字体文件
+ *
+ * php test/bench_glyph_index.php [查找次数]
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\Text;
+use Kingbes\Raylib\Utils\Font;
+
+$lookups = (int)($argv[1] ?? 20000);
+$ffi = Text::ffi();
+
+foreach ([100, 5000, 30000] as $glyphCount) {
+    // ASCII 之后接 CJK 统一表意文字
+    $glyphs = $ffi->new('GlyphInfo[' . $glyphCount . ']');
+    $codepoints = [];
+    for ($i = 0; $i < $glyphCount; $i++) {
+        $codepoints[] = $glyphs[$i]->value = $i < 95 ? 32 + $i : 0x4E00 + $i - 95;
+    }
+    $cdata = $ffi->new('Font');
+    $cdata->baseSize = 32;
+    $cdata->glyphCount = $glyphCount;
+    $cdata->glyphs = $ffi->cast('GlyphInfo *', \FFI::addr($glyphs[0]));
+    $font = new Font($cdata);
+
+    mt_srand(42);
+    $text = [];
+    for ($i = 0; $i < $lookups; $i++) {
+        $text[] = $codepoints[mt_rand(0, $glyphCount - 1)];
+    }
+
+    $t = hrtime(true);
+    $font->glyphIndex(0);
+    $build = hrtime(true) - $t;
+
+    $struct = $font->struct();
+    $t = hrtime(true);
+    foreach ($text as $codepoint) {
+        $ffi->GetGlyphIndex($struct, $codepoint);
+    }
+    $linear = hrtime(true) - $t;
+
+    $t = hrtime(true);
+    foreach ($text as $codepoint) {
+        $font->glyphIndex($codepoint);
+    }
+    $hashed = hrtime(true) - $t;
+
+    printf(
+        "%6d glyphs: GetGlyphIndex %8.1f ns/char, glyphIndex %8.1f ns/char, table build %7.3f ms\n",
+        $glyphCount,
+        $linear / $lookups,
+        $hashed / $lookups,
+        $build / 1e6
+    );
+}
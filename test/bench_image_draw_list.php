@@ -0,0 +1,119 @@
+<?php
+
+/**
+ * CPU 图像绘制对比：逐个 Textures::imageDraw*() 与 ImageDrawList 批量执行
+ *
+ * 两种写法分别绘制到同样的空白图像上，比较耗时并确认结果逐字节相同，不需要窗口。
+ * 工作负载：逐行描点（像素为主）与混合图元（矩形、线段、圆）
+ *
+ * php test/bench_image_draw_list.php [图像边长] [重复次数]
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\Textures;
+use Kingbes\Raylib\Utils;
+use Kingbes\Raylib\Utils\ImageDrawList;
+
+$size = (int)($argv[1] ?? 256);
+$repeat = (int)($argv[2] ?? 5);
+
+$palette = [
+    Utils::color(230, 41, 55),
+    Utils::color(0, 228, 48),
+    Utils::color(0, 121, 241),
+    Utils::color(253, 249, 0),
+    Utils::color(255, 255, 255, 128),
+];
+$blank = Utils::color(0, 0, 0, 0);
+
+// 逐行描点：每个像素一条命令，颜色按 8 像素一段变化
+$pixels = [];
+for ($y = 0; $y < $size; $y++) {
+    for ($x = 0; $x < $size; $x++) {
+        $pixels[] = [$x, $y, $palette[(($x >> 3) + $y) % count($palette)]];
+    }
+}
+
+// 混合图元
+mt_srand(42);
+$shapes = [];
+for ($i = 0; $i < 2000; $i++) {
+    $shapes[] = [$i % 4, mt_rand(-16, $size), mt_rand(-16, $size), mt_rand(1, 48), mt_rand(1, 48), $palette[$i % count($palette)]];
+}
+
+$workloads = [
+    'pixels' => [
+        function ($image) use ($pixels): void {
+            foreach ($pixels as [$x, $y, $color]) {
+                Textures::imageDrawPixel($image, $x, $y, $color);
+            }
+        },
+        function (ImageDrawList $list) use ($pixels): void {
+            foreach ($pixels as [$x, $y, $color]) {
+                $list->pixel($x, $y, $color);
+            }
+        },
+    ],
+    'shapes' => [
+        function ($image) use ($shapes): void {
+            foreach ($shapes as [$op, $x, $y, $w, $h, $color]) {
+                match ($op) {
+                    0 => Textures::imageDrawRectangle($image, $x, $y, $w, $h, $color),
+                    1 => Textures::imageDrawLine($image, $x, $y, $x + $w, $y + $h, $color),
+                    2 => Textures::imageDrawCircle($image, $x, $y, $w >> 1, $color),
+                    3 => Textures::imageDrawRectangleLines($image, Utils::rectangle($x, $y, $w, $h), 2, $color),
+                };
+            }
+        },
+        function (ImageDrawList $list) use ($shapes): void {
+            foreach ($shapes as [$op, $x, $y, $w, $h, $color]) {
+                match ($op) {
+                    0 => $list->rectangle($x, $y, $w, $h, $color),
+                    1 => $list->line($x, $y, $x + $w, $y + $h, $color),
+                    2 => $list->circle($x, $y, $w >> 1, $color),
+                    3 => $list->rectangleLines($x, $y, $w, $h, 2, $color),
+                };
+            }
+        },
+    ],
+];
+
+printf("image: %dx%d RGBA, %d runs\n", $size, $size, $repeat);
+$ok = true;
+foreach ($workloads as $name => [$direct, $record]) {
+    $directTime = 0;
+    $recordTime = 0;
+    $executeTime = 0;
+    $same = true;
+    for ($r = 0; $r < $repeat; $r++) {
+        $a = Textures::genImageColor($size, $size, $blank);
+        $t = hrtime(true);
+        $direct($a);
+        $directTime += hrtime(true) - $t;
+
+        $b = Textures::genImageColor($size, $size, $blank);
+        $list = new ImageDrawList();
+        $t = hrtime(true);
+        $record($list);
+        $recordTime += hrtime(true) - $t;
+        $t = hrtime(true);
+        Textures::imageDrawList($b, $list);
+        $executeTime += hrtime(true) - $t;
+
+        $same = $same && md5($a->pixels()->toString()) === md5($b->pixels()->toString());
+        Textures::unloadImage($a);
+        Textures::unloadImage($b);
+    }
+    $commands = count($list);
+    printf("%s (%d commands)\n", $name, $commands);
+    printf("  direct imageDraw*   %10.2f ms\n", $directTime / 1e6 / $repeat);
+    printf("  list record         %10.2f ms\n", $recordTime / 1e6 / $repeat);
+    printf("  list execute        %10.2f ms  (%.1fx vs direct, %.1fx incl. record)\n",
+        $executeTime / 1e6 / $repeat,
+        $directTime / max(1, $executeTime),
+        $directTime / max(1, $recordTime + $executeTime));
+    printf("  identical pixels    %s\n", $same ? 'yes' : 'NO');
+    $ok = $ok && $same;
+}
+exit($ok ? 0 : 1);
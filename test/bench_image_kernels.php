@@ -0,0 +1,59 @@
+<?php
+
+/**
+ * 图像处理并行对比：Textures::setImageWorkers(1) 与多进程分块
+ *
+ * 每个操作在同一张图像的副本上执行，并校验多进程结果与单进程逐字节相同。
+ * 不需要窗口。imageResize / imageBlurGaussian 始终在当前进程执行，只作参考。
+ *
+ * php test/bench_image_kernels.php [进程数] [宽度] [高度]
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\Textures;
+use Kingbes\Raylib\Utils;
+use Kingbes\Raylib\Utils\Image;
+
+$threads = (int)($argv[1] ?? 8);
+$width = (int)($argv[2] ?? 3840);
+$height = (int)($argv[3] ?? 2160);
+
+$source = Textures::genImagePerlinNoise($width, $height, 0, 0, 4.0);
+Textures::imageColorTint($source, Utils::color(255, 180, 90));
+
+$sharpen = [0, -1, 0, -1, 5, -1, 0, -1, 0];
+$operations = [
+    'imageKernelConvolution' => fn(Image $image) => Textures::imageKernelConvolution($image, $sharpen, 9),
+    'imageColorGrayscale' => fn(Image $image) => Textures::imageColorGrayscale($image),
+    'imageColorContrast' => fn(Image $image) => Textures::imageColorContrast($image, 40),
+    'imageColorBrightness' => fn(Image $image) => Textures::imageColorBrightness($image, 30),
+    'imageColorInvert' => fn(Image $image) => Textures::imageColorInvert($image),
+    'imageResize' => fn(Image $image) => Textures::imageResize($image, intdiv($width, 4), intdiv($height, 4)),
+    'imageBlurGaussian' => fn(Image $image) => Textures::imageBlurGaussian($image, 4),
+];
+
+printf("%dx%d, %d processes%s\n", $width, $height, $threads, Utils\ImageWorkerPool::supported() ? '' : ' (pcntl unavailable, single-threaded)');
+
+foreach ($operations as $name => $operation) {
+    $results = [];
+    foreach ([1, $threads] as $n) {
+        Textures::setImageWorkers($n);
+        $image = Textures::imageCopy($source);
+        $t = hrtime(true);
+        $operation($image);
+        $results[$n] = [hrtime(true) - $t, md5($image->pixels()->toString())];
+        Textures::unloadImage($image);
+    }
+    printf(
+        "%-24s 1: %8.2f ms  %d: %8.2f ms  x%5.2f  %s\n",
+        $name,
+        $results[1][0] / 1e6,
+        $threads,
+        $results[$threads][0] / 1e6,
+        $results[1][0] / max(1, $results[$threads][0]),
+        $results[1][1] === $results[$threads][1] ? 'identical' : 'MISMATCH'
+    );
+}
+
+Textures::unloadImage($source);
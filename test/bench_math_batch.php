@@ -0,0 +1,109 @@
+<?php
+
+/**
+ * raymath 批量运算对比：逐个 Math::vector3Transform() / vector2Lerp() 与批量版本
+ *
+ * 最后检查 Vector3[] 和 Vector2Buffer 作为缓冲区时结果与逐个调用一致，
+ * 以及 count 超过数组大小时被拒绝
+ *
+ * php test/bench_math_batch.php
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\Math;
+use Kingbes\Raylib\Utils;
+use Kingbes\Raylib\Utils\Vector2Buffer;
+
+$matrix = Math::matrixRotateY(0.5);
+
+foreach ([100, 1000, 10000, 100000] as $count) {
+    $points = [];
+    $starts = [];
+    $ends = [];
+    $src3 = Math::ffi()->new('float[' . ($count * 3) . ']');
+    $dst3 = Math::ffi()->new('float[' . ($count * 3) . ']');
+    $a2 = Math::ffi()->new('float[' . ($count * 2) . ']');
+    $b2 = Math::ffi()->new('float[' . ($count * 2) . ']');
+    $dst2 = Math::ffi()->new('float[' . ($count * 2) . ']');
+    for ($i = 0; $i < $count; $i++) {
+        $points[] = Utils::vector3($i, $i * 0.5, -$i);
+        $starts[] = Utils::vector2($i, 0);
+        $ends[] = Utils::vector2(0, $i);
+        [$src3[$i * 3], $src3[$i * 3 + 1], $src3[$i * 3 + 2]] = [$i, $i * 0.5, -$i];
+        [$a2[$i * 2], $a2[$i * 2 + 1], $b2[$i * 2], $b2[$i * 2 + 1]] = [$i, 0, 0, $i];
+    }
+
+    $t = hrtime(true);
+    foreach ($points as $point) {
+        Math::vector3Transform($point, $matrix);
+    }
+    $transform = hrtime(true) - $t;
+
+    $t = hrtime(true);
+    Math::vector3TransformBatch($dst3, $src3, $count, $matrix);
+    $transformBatch = hrtime(true) - $t;
+
+    $t = hrtime(true);
+    foreach ($starts as $i => $start) {
+        Math::vector2Lerp($start, $ends[$i], 0.25);
+    }
+    $lerp = hrtime(true) - $t;
+
+    $t = hrtime(true);
+    Math::vector2LerpBatch($dst2, $a2, $b2, $count, 0.25);
+    $lerpBatch = hrtime(true) - $t;
+
+    printf(
+        "%7d | vector3Transform %7.1f ns/elem, batch %6.1f ns/elem (x%.1f) | vector2Lerp %7.1f ns/elem, batch %6.1f ns/elem (x%.1f)\n",
+        $count,
+        $transform / $count,
+        $transformBatch / $count,
+        $transform / max(1, $transformBatch),
+        $lerp / $count,
+        $lerpBatch / $count,
+        $lerp / max(1, $lerpBatch)
+    );
+}
+
+// 结构体数组缓冲区：Vector3[] 与 Vector2Buffer
+$count = 1000;
+$ok = true;
+$src = Math::ffi()->new('Vector3[' . $count . ']');
+$dst = Math::ffi()->new('Vector3[' . $count . ']');
+for ($i = 0; $i < $count; $i++) {
+    [$src[$i]->x, $src[$i]->y, $src[$i]->z] = [$i, $i * 0.5, -$i];
+}
+Math::vector3TransformBatch($dst, $src, $count, $matrix);
+for ($i = 0; $i < $count; $i++) {
+    $expected = Math::vector3Transform(Utils::vector3($i, $i * 0.5, -$i), $matrix);
+    $ok = $ok && abs($dst[$i]->x - $expected->x) < 1e-3 && abs($dst[$i]->y - $expected->y) < 1e-3 && abs($dst[$i]->z - $expected->z) < 1e-3;
+}
+printf("Vector3[] vector3TransformBatch matches vector3Transform: %s\n", $ok ? 'yes' : 'NO');
+
+$a = new Vector2Buffer($count);
+$b = new Vector2Buffer($count);
+$out = new Vector2Buffer($count);
+for ($i = 0; $i < $count; $i++) {
+    $a->append($i, 0);
+    $b->append(0, $i);
+    $out->append(0, 0);
+}
+Math::vector2LerpBatch($out->struct(), $a->struct(), $b->struct(), $count, 0.25);
+$same = true;
+for ($i = 0; $i < $count; $i++) {
+    $expected = Math::vector2Lerp($a->get($i), $b->get($i), 0.25);
+    $point = $out->get($i);
+    $same = $same && abs($point->x - $expected->x) < 1e-3 && abs($point->y - $expected->y) < 1e-3;
+}
+printf("Vector2Buffer vector2LerpBatch matches vector2Lerp: %s\n", $same ? 'yes' : 'NO');
+$ok = $ok && $same;
+
+$threw = false;
+try {
+    Math::vector3TransformBatch($dst, $src, $count + 1, $matrix);
+} catch (\InvalidArgumentException) {
+    $threw = true;
+}
+printf("count larger than the array is rejected: %s\n", $threw ? 'yes' : 'NO');
+exit($ok && $threw ? 0 : 1);
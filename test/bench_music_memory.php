@@ -0,0 +1,113 @@
+<?php
+
+/**
+ * 从内存加载音乐流对比：旧写法逐字节 ord() 复制与 Audio::loadMusicStreamFromMemory() 一次 memcpy
+ *
+ * 不给文件时只比较复制阶段（合成 10MB 数据，不需要音频设备），并从内存解码一段合成 WAV；
+ * 给出音乐文件时同时比较完整加载（需要音频设备）
+ *
+ * php test/bench_music_memory.php [音乐文件]
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\Audio;
+
+$file = $argv[1] ?? null;
+$ffi = Audio::ffi();
+
+// 旧写法：new char[n] 后逐字节赋值
+$legacyCopy = function (string $data) use ($ffi): \FFI\CData {
+    $dataSize = strlen($data);
+    $c_data = $ffi->new("char[" . $dataSize . "]");
+    for ($i = 0; $i < $dataSize; $i++) {
+        $c_data[$i] = ord($data[$i]);
+    }
+    return $c_data;
+};
+$memcpyCopy = function (string $data) use ($ffi): \FFI\CData {
+    $buffer = $ffi->new('unsigned char[' . strlen($data) . ']');
+    \FFI::memcpy($buffer, $data, strlen($data));
+    return $buffer;
+};
+
+$data = $file !== null ? file_get_contents($file) : random_bytes(10 * 1024 * 1024);
+printf("data: %.1f MB%s\n", strlen($data) / 1048576, $file !== null ? " (" . basename($file) . ")" : " (synthetic)");
+
+$t = hrtime(true);
+$legacy = $legacyCopy($data);
+$legacyTime = hrtime(true) - $t;
+$t = hrtime(true);
+$copy = $memcpyCopy($data);
+$memcpyTime = hrtime(true) - $t;
+$same = \FFI::string($legacy, strlen($data)) === \FFI::string($copy, strlen($data));
+unset($legacy, $copy);
+
+printf("copy into native buffer\n");
+printf("  ord() per byte    %10.2f ms\n", $legacyTime / 1e6);
+printf("  single memcpy     %10.2f ms  (%.0fx)\n", $memcpyTime / 1e6, $legacyTime / max(1, $memcpyTime));
+printf("  identical bytes   %s\n", $same ? 'yes' : 'NO');
+
+// loadWaveFromMemory()：合成 1 秒 44.1kHz 16 位立体声 WAV，解码不需要音频设备
+$frames = 44100;
+$pcm = '';
+for ($i = 0; $i < $frames; $i++) {
+    $v = (int)(8000 * sin(2 * M_PI * 440 * $i / 44100));
+    $pcm .= pack('v2', $v & 0xFFFF, $v & 0xFFFF);
+}
+$wav = 'RIFF' . pack('V', 36 + strlen($pcm)) . 'WAVE'
+    . 'fmt ' . pack('VvvVVvv', 16, 1, 2, 44100, 44100 * 4, 4, 16)
+    . 'data' . pack('V', strlen($pcm)) . $pcm;
+$t = hrtime(true);
+$wave = Audio::loadWaveFromMemory('.wav', $wav);
+$waveTime = hrtime(true) - $t;
+$waveOk = Audio::isWaveValid($wave) && $wave->frameCount === $frames && $wave->channels === 2 && $wave->sampleRate === 44100;
+printf("loadWaveFromMemory (%.1f KB wav)\n", strlen($wav) / 1024);
+printf("  decoded           %10.2f ms  %d frames, %d ch, %d Hz: %s\n", $waveTime / 1e6, $wave->frameCount, $wave->channels, $wave->sampleRate, $waveOk ? 'ok' : 'MISMATCH');
+if (Audio::isWaveValid($wave)) {
+    Audio::unloadWave($wave);
+}
+$same = $same && $waveOk;
+
+if ($file === null) {
+    exit($same ? 0 : 1);
+}
+
+Audio::initAudioDevice();
+if (!Audio::isAudioDeviceReady()) {
+    echo "audio device not available, skipping load test\n";
+    exit($same ? 0 : 1);
+}
+$fileType = '.' . strtolower(pathinfo($file, PATHINFO_EXTENSION));
+
+$t = hrtime(true);
+$buffer = $legacyCopy($data);
+$music = $ffi->LoadMusicStreamFromMemory($fileType, $ffi->cast('unsigned char *', \FFI::addr($buffer)), strlen($data));
+$legacyLoad = hrtime(true) - $t;
+$legacyValid = $ffi->IsMusicValid($music);
+if ($legacyValid) {
+    $ffi->UnloadMusicStream($music);
+}
+unset($buffer);
+
+$t = hrtime(true);
+$music = Audio::loadMusicStreamFromMemory($fileType, $data);
+$newLoad = hrtime(true) - $t;
+$newValid = Audio::isMusicValid($music);
+
+printf("LoadMusicStreamFromMemory (%s)\n", $fileType);
+printf("  ord() per byte    %10.2f ms  valid: %s\n", $legacyLoad / 1e6, $legacyValid ? 'yes' : 'no');
+printf("  single memcpy     %10.2f ms  valid: %s, buffer held: %d bytes\n", $newLoad / 1e6, $newValid ? 'yes' : 'no', $music->sourceSize());
+
+if ($newValid) {
+    // 播放一秒，确认解码器读取的缓冲区仍然有效
+    Audio::playMusicStream($music);
+    $end = microtime(true) + 1.0;
+    while (microtime(true) < $end) {
+        Audio::updateMusicStream($music);
+        usleep(10000);
+    }
+    printf("  played            %.2f s\n", Audio::getMusicTimePlayed($music));
+    Audio::unloadMusicStream($music);
+}
+Audio::closeAudioDevice();
@@ -0,0 +1,73 @@
+<?php
+
+/**
+ * 文本排版缓存对比：每帧 Text::drawTextEx() + Text::measureTextEx() 与 TextLayout
+ *
+ * static：每帧绘制相同的标签；dynamic：每帧文本都变化（计数器），TextLayout 每帧重新排版
+ *
+ * php test/bench_text_layout.php [标签数量] [帧数]
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\Core;
+use Kingbes\Raylib\Text;
+use Kingbes\Raylib\Utils;
+
+$labels = (int)($argv[1] ?? 50);
+$frames = (int)($argv[2] ?? 120);
+
+Core::initWindow(800, 600, "bench - TextLayout");
+
+$font = Text::getFontDefault();
+$black = Utils::color(0, 0, 0);
+$white = Utils::color(255, 255, 255);
+$fontSize = 20.0;
+$spacing = 2.0;
+
+$positions = [];
+for ($i = 0; $i < $labels; $i++) {
+    $positions[] = Utils::vector2(10 + ($i % 4) * 190, 10 + intdiv($i, 4) * 24 % 580);
+}
+
+$staticText = fn(int $i, int $frame) => "Score: 12345  Label #" . $i;
+$dynamicText = fn(int $i, int $frame) => "Score: " . ($frame * 37 + $i) . "  Label #" . $i;
+
+$layouts = [];
+for ($i = 0; $i < $labels; $i++) {
+    $layouts[] = Text::layoutText($font, '', $fontSize, $spacing);
+}
+
+$modes = [
+    'drawTextEx' => function (callable $text, int $frame) use ($font, $positions, $fontSize, $spacing, $white) {
+        foreach ($positions as $i => $position) {
+            $str = $text($i, $frame);
+            Text::measureTextEx($font, $str, $fontSize, $spacing);
+            Text::drawTextEx($font, $str, $position, $fontSize, $spacing, $white);
+        }
+    },
+    'TextLayout' => function (callable $text, int $frame) use ($layouts, $positions, $white) {
+        foreach ($positions as $i => $position) {
+            $layout = $layouts[$i]->setText($text($i, $frame));
+            $layout->measure();
+            $layout->draw($position, $white);
+        }
+    },
+];
+
+foreach (['static' => $staticText, 'dynamic' => $dynamicText] as $case => $text) {
+    foreach ($modes as $name => $draw) {
+        $elapsed = 0;
+        for ($f = 0; $f < $frames && !Core::windowShouldClose(); $f++) {
+            Core::beginDrawing();
+            Core::clearBackground($black);
+            $t = hrtime(true);
+            $draw($text, $f);
+            $elapsed += hrtime(true) - $t;
+            Core::endDrawing();
+        }
+        printf("%-8s %-12s %4d labels: %8.3f ms/frame\n", $case, $name, $labels, $elapsed / $frames / 1e6);
+    }
+}
+
+Core::closeWindow();
@@ -7,6 +7,7 @@ require dirname(__DIR__) . '/vendor/autoload.php';
 use Kingbes\Raylib\Core; //核心
 use Kingbes\Raylib\Text; // 文本
 use Kingbes\Raylib\Utils; // 工具类
+use Kingbes\Raylib\Utils\CodepointSet; // 码位集合
 
 // 宽高
 $screenWidth = 800;
@@ -16,13 +17,20 @@ Core::initWindow($screenWidth, $screenHeight, "使用中文字体"); //初始化
 
 Core::setTargetFPS(60); //设置目标帧率
 
+$text = "你好，中文！asd"; // 中文文本
+
+// 只加载 ASCII 和文本中出现的字符
+$codepoints = (new CodepointSet())->addBlock('ASCII')->addText($text);
+
 $font = Text::loadFontEx(
     __DIR__ . DIRECTORY_SEPARATOR . "AlimamaShuHeiTi-Bold.ttf",
     // __DIR__ . DIRECTORY_SEPARATOR . "seguiemj.ttf",
-    64
+    64,
+    $codepoints,
+    $report
 );
 
-$text = "你好，中文！asd"; // 中文文本
+printf("字形 %d 个，耗时 %.3f 秒，图集 %d KB\n", $report['glyphCount'], $report['time'], $report['atlasBytes'] / 1024);
 
 
 // 白色
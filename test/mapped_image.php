@@ -0,0 +1,167 @@
+<?php
+
+/**
+ * 内存映射图像测试：生成大尺寸合成 RAW 文件，检查 Textures::loadImageRawMapped() 的
+ * 像素内容、内存占用、写时复制、提升，全 0xFF 且无文件头的文件（映射区开头与 MAP_FAILED 相同），
+ * 以及超过 2GB 的图像拒绝提升
+ *
+ * php test/mapped_image.php [宽度] [高度]   （默认 8192x8192 RGBA，256MB）
+ */
+
+require dirname(__DIR__) . "/vendor/autoload.php";
+
+use Kingbes\Raylib\PixelFormat;
+use Kingbes\Raylib\Textures;
+
+$width = (int)($argv[1] ?? 8192);
+$height = (int)($argv[2] ?? 8192);
+$header = 128;
+$format = PixelFormat::R8G8B8A8->value;
+$dataSize = $width * $height * 4;
+
+$failed = 0;
+function check(bool $ok, string $message): void
+{
+    global $failed;
+    echo ($ok ? "PASS " : "FAIL ") . $message . PHP_EOL;
+    $failed += $ok ? 0 : 1;
+}
+
+// 像素 (x, y) = [x & 255, y & 255, (x >> 8) & 255, 255]
+function expected(int $x, int $y): array
+{
+    return [$x & 255, $y & 255, ($x >> 8) & 255, 255];
+}
+
+function rssBytes(): int
+{
+    // ru_maxrss：Linux 为 KB，macOS 为字节
+    $rss = getrusage()['ru_maxrss'];
+    return PHP_OS_FAMILY === 'Darwin' ? $rss : $rss * 1024;
+}
+
+$file = sys_get_temp_dir() . '/php-raylib-mapped-' . getmypid() . '.raw';
+$hugeFile = sys_get_temp_dir() . '/php-raylib-mapped-huge-' . getmypid() . '.raw';
+$whiteFile = sys_get_temp_dir() . '/php-raylib-mapped-white-' . getmypid() . '.raw';
+$fp = fopen($file, 'wb');
+fwrite($fp, str_repeat("\xAB", $header));
+$rows = [];
+for ($g = 0; $g < 256; $g++) {
+    $row = '';
+    for ($x = 0; $x < $width; $x++) {
+        $row .= pack('C4', ...expected($x, $g));
+    }
+    $rows[$g] = $row;
+}
+for ($y = 0; $y < $height; $y++) {
+    fwrite($fp, $rows[$y & 255]);
+}
+fclose($fp);
+unset($rows, $row);
+printf("synthetic raw file: %dx%d RGBA, %.1f MB\n", $width, $height, filesize($file) / 1048576);
+
+try {
+    $rssBefore = rssBytes();
+    $image = Textures::loadImageRawMapped($file, $width, $height, $format, $header);
+    check($image->isMapped(), "image data points into the mapping");
+    check($image->width === $width && $image->height === $height && $image->format === $format, "image header fields");
+
+    $pixels = $image->pixels();
+    mt_srand(1);
+    $ok = true;
+    for ($i = 0; $i < 2000; $i++) {
+        $x = mt_rand(0, $width - 1);
+        $y = mt_rand(0, $height - 1);
+        $ok = $ok && $pixels->getPixel($x, $y) === expected($x, $y);
+    }
+    $ok = $ok && $pixels->getPixel($width - 1, $height - 1) === expected($width - 1, $height - 1);
+    check($ok, "sampled pixels match the file (header skipped)");
+
+    $rssDelta = rssBytes() - $rssBefore;
+    printf("     peak RSS growth after sampling: %.1f MB\n", $rssDelta / 1048576);
+    check($rssDelta < $dataSize / 4, "sampling does not read the whole file into memory");
+
+    $threw = false;
+    try {
+        $pixels->get($width, 0);
+    } catch (\OutOfRangeException) {
+        $threw = true;
+    }
+    check($threw, "out of range reads are rejected");
+
+    // 像素视图写入：私有映射写时复制，文件不变
+    $pixels->setPixel(10, 20, 1, 2, 3, 4);
+    check($pixels->getPixel(10, 20) === [1, 2, 3, 4], "write through pixel view");
+    $fp = fopen($file, 'rb');
+    fseek($fp, $header + (20 * $width + 10) * 4);
+    check(array_values(unpack('C4', fread($fp, 4))) === expected(10, 20), "file is unchanged after write");
+    fclose($fp);
+    check($image->isMapped(), "pixel view writes do not promote");
+
+    // raylib 原地修改前提升到 raylib 内存
+    Textures::imageFlipVertical($image);
+    check(!$image->isMapped(), "in-place raylib operation promotes the image");
+    $pixels = $image->pixels();
+    check($pixels->getPixel(10, $height - 1 - 20) === [1, 2, 3, 4], "promoted image keeps written pixels");
+    check($pixels->getPixel(5, 0) === expected(5, $height - 1), "promoted image is flipped");
+    Textures::unloadImage($image);
+
+    // 与 loadImageRaw() 读入的像素逐字节相同
+    $mapped = Textures::loadImageRawMapped($file, $width, $height, $format, $header);
+    $loaded = Textures::loadImageRaw($file, $width, $height, $format, $header);
+    check(md5($mapped->pixels()->toString()) === md5($loaded->pixels()->toString()), "mapped pixels equal loadImageRaw()");
+    Textures::unloadImage($mapped);
+    Textures::unloadImage($loaded);
+
+    $threw = false;
+    try {
+        Textures::loadImageRawMapped($file, $width, $height + 1, $format, $header);
+    } catch (\InvalidArgumentException) {
+        $threw = true;
+    }
+    check($threw, "file smaller than the pixel data is rejected");
+
+    // 全白 RGBA、没有文件头：映射区的前 8 字节是 0xFF..FF，与 (void *)-1 的位模式相同，
+    // 检查 mmap() 失败时必须比较指针值而不是读取映射区
+    file_put_contents($whiteFile, str_repeat("\xFF", 64 * 64 * 4));
+    $white = Textures::loadImageRawMapped($whiteFile, 64, 64, $format);
+    check($white->isMapped(), "all-0xFF file without header maps successfully");
+    check($white->pixels()->getPixel(63, 63) === [255, 255, 255, 255], "all-0xFF mapped pixels are readable");
+    Textures::unloadImage($white);
+
+    // 超过 2GB 的像素数据：raylib 无法分配，提升被拒绝，图像保持映射（稀疏文件，不占磁盘）
+    $hugeWidth = 32768;
+    $hugeHeight = 16385;
+    $fp = fopen($hugeFile, 'wb');
+    $sparse = ftruncate($fp, $hugeWidth * $hugeHeight * 4);
+    fclose($fp);
+    if ($sparse) {
+        $huge = Textures::loadImageRawMapped($hugeFile, $hugeWidth, $hugeHeight, $format);
+        $threw = false;
+        try {
+            $huge->promote();
+        } catch (\RuntimeException) {
+            $threw = true;
+        }
+        check($threw, "promoting more than Image::MAX_DATA_SIZE bytes is rejected");
+        check($huge->isMapped(), "oversized image stays mapped");
+        $threw = false;
+        try {
+            Textures::imageFlipVertical($huge);
+        } catch (\RuntimeException) {
+            $threw = true;
+        }
+        check($threw, "in-place raylib operation on an oversized image is rejected");
+        $huge->pixels()->setPixel($hugeWidth - 1, $hugeHeight - 1, 9, 8, 7, 6);
+        check($huge->pixels()->getPixel($hugeWidth - 1, $hugeHeight - 1) === [9, 8, 7, 6], "oversized image is usable through pixels()");
+        Textures::unloadImage($huge);
+    } else {
+        echo "SKIP oversized image guard (sparse files not supported)" . PHP_EOL;
+    }
+} finally {
+    @unlink($file);
+    @unlink($hugeFile);
+    @unlink($whiteFile);
+}
+
+exit($failed > 0 ? 1 : 0);